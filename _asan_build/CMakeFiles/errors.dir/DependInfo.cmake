@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/arena.cpp" "CMakeFiles/errors.dir/src/arena.cpp.o" "gcc" "CMakeFiles/errors.dir/src/arena.cpp.o.d"
+  "/root/repo/src/context.cpp" "CMakeFiles/errors.dir/src/context.cpp.o" "gcc" "CMakeFiles/errors.dir/src/context.cpp.o.d"
+  "/root/repo/src/dedup.cpp" "CMakeFiles/errors.dir/src/dedup.cpp.o" "gcc" "CMakeFiles/errors.dir/src/dedup.cpp.o.d"
+  "/root/repo/src/error.cpp" "CMakeFiles/errors.dir/src/error.cpp.o" "gcc" "CMakeFiles/errors.dir/src/error.cpp.o.d"
+  "/root/repo/src/flight.cpp" "CMakeFiles/errors.dir/src/flight.cpp.o" "gcc" "CMakeFiles/errors.dir/src/flight.cpp.o.d"
+  "/root/repo/src/fmt.cpp" "CMakeFiles/errors.dir/src/fmt.cpp.o" "gcc" "CMakeFiles/errors.dir/src/fmt.cpp.o.d"
+  "/root/repo/src/format.cpp" "CMakeFiles/errors.dir/src/format.cpp.o" "gcc" "CMakeFiles/errors.dir/src/format.cpp.o.d"
+  "/root/repo/src/freeze.cpp" "CMakeFiles/errors.dir/src/freeze.cpp.o" "gcc" "CMakeFiles/errors.dir/src/freeze.cpp.o.d"
+  "/root/repo/src/intern.cpp" "CMakeFiles/errors.dir/src/intern.cpp.o" "gcc" "CMakeFiles/errors.dir/src/intern.cpp.o.d"
+  "/root/repo/src/join.cpp" "CMakeFiles/errors.dir/src/join.cpp.o" "gcc" "CMakeFiles/errors.dir/src/join.cpp.o.d"
+  "/root/repo/src/json.cpp" "CMakeFiles/errors.dir/src/json.cpp.o" "gcc" "CMakeFiles/errors.dir/src/json.cpp.o.d"
+  "/root/repo/src/observe.cpp" "CMakeFiles/errors.dir/src/observe.cpp.o" "gcc" "CMakeFiles/errors.dir/src/observe.cpp.o.d"
+  "/root/repo/src/pool.cpp" "CMakeFiles/errors.dir/src/pool.cpp.o" "gcc" "CMakeFiles/errors.dir/src/pool.cpp.o.d"
+  "/root/repo/src/registry.cpp" "CMakeFiles/errors.dir/src/registry.cpp.o" "gcc" "CMakeFiles/errors.dir/src/registry.cpp.o.d"
+  "/root/repo/src/serialize.cpp" "CMakeFiles/errors.dir/src/serialize.cpp.o" "gcc" "CMakeFiles/errors.dir/src/serialize.cpp.o.d"
+  "/root/repo/src/symindex.cpp" "CMakeFiles/errors.dir/src/symindex.cpp.o" "gcc" "CMakeFiles/errors.dir/src/symindex.cpp.o.d"
+  "/root/repo/src/trace.cpp" "CMakeFiles/errors.dir/src/trace.cpp.o" "gcc" "CMakeFiles/errors.dir/src/trace.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
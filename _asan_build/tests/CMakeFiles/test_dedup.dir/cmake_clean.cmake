@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_dedup.dir/test_dedup.cpp.o"
+  "CMakeFiles/test_dedup.dir/test_dedup.cpp.o.d"
+  "test_dedup"
+  "test_dedup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dedup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
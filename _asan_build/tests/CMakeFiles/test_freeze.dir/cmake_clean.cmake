@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_freeze.dir/test_freeze.cpp.o"
+  "CMakeFiles/test_freeze.dir/test_freeze.cpp.o.d"
+  "test_freeze"
+  "test_freeze.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_freeze.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_intern.dir/test_intern.cpp.o"
+  "CMakeFiles/test_intern.dir/test_intern.cpp.o.d"
+  "test_intern"
+  "test_intern.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_intern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_observe.dir/test_observe.cpp.o"
+  "CMakeFiles/test_observe.dir/test_observe.cpp.o.d"
+  "test_observe"
+  "test_observe.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_observe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
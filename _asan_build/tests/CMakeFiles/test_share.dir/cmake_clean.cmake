@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_share.dir/test_share.cpp.o"
+  "CMakeFiles/test_share.dir/test_share.cpp.o.d"
+  "test_share"
+  "test_share.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_share.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_static_error.dir/test_static_error.cpp.o"
+  "CMakeFiles/test_static_error.dir/test_static_error.cpp.o.d"
+  "test_static_error"
+  "test_static_error.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_static_error.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
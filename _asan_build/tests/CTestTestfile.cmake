@@ -0,0 +1,62 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_asan_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_core "/root/repo/_asan_build/tests/test_core")
+set_tests_properties(test_core PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;10;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_trace "/root/repo/_asan_build/tests/test_trace")
+set_tests_properties(test_trace PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;11;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_arena "/root/repo/_asan_build/tests/test_arena")
+set_tests_properties(test_arena PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;12;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_message "/root/repo/_asan_build/tests/test_message")
+set_tests_properties(test_message PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;13;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pool "/root/repo/_asan_build/tests/test_pool")
+set_tests_properties(test_pool PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;14;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_static_error "/root/repo/_asan_build/tests/test_static_error")
+set_tests_properties(test_static_error PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;15;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_serialize "/root/repo/_asan_build/tests/test_serialize")
+set_tests_properties(test_serialize PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;16;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_join "/root/repo/_asan_build/tests/test_join")
+set_tests_properties(test_join PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;17;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_symbol_cache "/root/repo/_asan_build/tests/test_symbol_cache")
+set_tests_properties(test_symbol_cache PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;18;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_category "/root/repo/_asan_build/tests/test_category")
+set_tests_properties(test_category PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;19;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_format "/root/repo/_asan_build/tests/test_format")
+set_tests_properties(test_format PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;20;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_observe "/root/repo/_asan_build/tests/test_observe")
+set_tests_properties(test_observe PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;21;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_intern "/root/repo/_asan_build/tests/test_intern")
+set_tests_properties(test_intern PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;22;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_raw_capture "/root/repo/_asan_build/tests/test_raw_capture")
+set_tests_properties(test_raw_capture PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;23;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_sampling "/root/repo/_asan_build/tests/test_sampling")
+set_tests_properties(test_sampling PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;24;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_context "/root/repo/_asan_build/tests/test_context")
+set_tests_properties(test_context PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;25;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_share "/root/repo/_asan_build/tests/test_share")
+set_tests_properties(test_share PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;26;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_dedup "/root/repo/_asan_build/tests/test_dedup")
+set_tests_properties(test_dedup PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;27;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_symindex "/root/repo/_asan_build/tests/test_symindex")
+set_tests_properties(test_symindex PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;28;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_expected "/root/repo/_asan_build/tests/test_expected")
+set_tests_properties(test_expected PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;31;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_origin "/root/repo/_asan_build/tests/test_origin")
+set_tests_properties(test_origin PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;32;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_json "/root/repo/_asan_build/tests/test_json")
+set_tests_properties(test_json PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;33;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_freeze "/root/repo/_asan_build/tests/test_freeze")
+set_tests_properties(test_freeze PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;34;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_budget "/root/repo/_asan_build/tests/test_budget")
+set_tests_properties(test_budget PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;35;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_fmt "/root/repo/_asan_build/tests/test_fmt")
+set_tests_properties(test_fmt PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;36;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_serialize_batch "/root/repo/_asan_build/tests/test_serialize_batch")
+set_tests_properties(test_serialize_batch PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;37;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_registry "/root/repo/_asan_build/tests/test_registry")
+set_tests_properties(test_registry PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;38;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_flight "/root/repo/_asan_build/tests/test_flight")
+set_tests_properties(test_flight PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;7;add_test;/root/repo/tests/CMakeLists.txt;39;errors_add_test;/root/repo/tests/CMakeLists.txt;0;")
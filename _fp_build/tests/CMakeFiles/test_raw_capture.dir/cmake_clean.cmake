@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_raw_capture.dir/test_raw_capture.cpp.o"
+  "CMakeFiles/test_raw_capture.dir/test_raw_capture.cpp.o.d"
+  "test_raw_capture"
+  "test_raw_capture.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_raw_capture.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_symbol_cache.dir/test_symbol_cache.cpp.o"
+  "CMakeFiles/test_symbol_cache.dir/test_symbol_cache.cpp.o.d"
+  "test_symbol_cache"
+  "test_symbol_cache.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_symbol_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/errors.dir/src/arena.cpp.o"
+  "CMakeFiles/errors.dir/src/arena.cpp.o.d"
+  "CMakeFiles/errors.dir/src/context.cpp.o"
+  "CMakeFiles/errors.dir/src/context.cpp.o.d"
+  "CMakeFiles/errors.dir/src/dedup.cpp.o"
+  "CMakeFiles/errors.dir/src/dedup.cpp.o.d"
+  "CMakeFiles/errors.dir/src/error.cpp.o"
+  "CMakeFiles/errors.dir/src/error.cpp.o.d"
+  "CMakeFiles/errors.dir/src/flight.cpp.o"
+  "CMakeFiles/errors.dir/src/flight.cpp.o.d"
+  "CMakeFiles/errors.dir/src/fmt.cpp.o"
+  "CMakeFiles/errors.dir/src/fmt.cpp.o.d"
+  "CMakeFiles/errors.dir/src/format.cpp.o"
+  "CMakeFiles/errors.dir/src/format.cpp.o.d"
+  "CMakeFiles/errors.dir/src/freeze.cpp.o"
+  "CMakeFiles/errors.dir/src/freeze.cpp.o.d"
+  "CMakeFiles/errors.dir/src/intern.cpp.o"
+  "CMakeFiles/errors.dir/src/intern.cpp.o.d"
+  "CMakeFiles/errors.dir/src/join.cpp.o"
+  "CMakeFiles/errors.dir/src/join.cpp.o.d"
+  "CMakeFiles/errors.dir/src/json.cpp.o"
+  "CMakeFiles/errors.dir/src/json.cpp.o.d"
+  "CMakeFiles/errors.dir/src/observe.cpp.o"
+  "CMakeFiles/errors.dir/src/observe.cpp.o.d"
+  "CMakeFiles/errors.dir/src/pool.cpp.o"
+  "CMakeFiles/errors.dir/src/pool.cpp.o.d"
+  "CMakeFiles/errors.dir/src/registry.cpp.o"
+  "CMakeFiles/errors.dir/src/registry.cpp.o.d"
+  "CMakeFiles/errors.dir/src/serialize.cpp.o"
+  "CMakeFiles/errors.dir/src/serialize.cpp.o.d"
+  "CMakeFiles/errors.dir/src/symindex.cpp.o"
+  "CMakeFiles/errors.dir/src/symindex.cpp.o.d"
+  "CMakeFiles/errors.dir/src/trace.cpp.o"
+  "CMakeFiles/errors.dir/src/trace.cpp.o.d"
+  "liberrors.a"
+  "liberrors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/errors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/errors_bench.dir/bench_errors.cpp.o"
+  "CMakeFiles/errors_bench.dir/bench_errors.cpp.o.d"
+  "errors_bench"
+  "errors_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/errors_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
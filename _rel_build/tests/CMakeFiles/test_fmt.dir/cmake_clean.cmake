@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fmt.dir/test_fmt.cpp.o"
+  "CMakeFiles/test_fmt.dir/test_fmt.cpp.o.d"
+  "test_fmt"
+  "test_fmt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fmt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_join.dir/test_join.cpp.o"
+  "CMakeFiles/test_join.dir/test_join.cpp.o.d"
+  "test_join"
+  "test_join.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_join.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_serialize_batch.dir/test_serialize_batch.cpp.o"
+  "CMakeFiles/test_serialize_batch.dir/test_serialize_batch.cpp.o.d"
+  "test_serialize_batch"
+  "test_serialize_batch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_serialize_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_symindex.dir/test_symindex.cpp.o"
+  "CMakeFiles/test_symindex.dir/test_symindex.cpp.o.d"
+  "test_symindex"
+  "test_symindex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_symindex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/errors-symindex.dir/symindex_main.cpp.o"
+  "CMakeFiles/errors-symindex.dir/symindex_main.cpp.o.d"
+  "errors-symindex"
+  "errors-symindex.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/errors-symindex.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
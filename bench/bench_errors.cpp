@@ -0,0 +1,181 @@
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "errors/errors.hpp"
+#include "errors/format.hpp"
+#include "errors/pool.hpp"
+#include "errors/json.hpp"
+#include "errors/serialize.hpp"
+#include "harness.hpp"
+
+namespace {
+
+inline constexpr auto cat_timeout = errors::category{1u << 0};
+inline constexpr errors::static_error kErrTimeout{"timeout", cat_timeout};
+
+// Prevent the optimizer from discarding a result.
+template <typename T> inline void keep(T &&value) {
+  asm volatile("" : : "g"(value) : "memory");
+}
+
+errors::error make_chain(int depth) {
+  errors::error err = errors::new_error("root cause");
+  for (int i = 0; i < depth; ++i) {
+    err = errors::wrap(std::move(err), "layer");
+  }
+  return err;
+}
+
+void bench_new_error(std::uint64_t iters) {
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error err = errors::new_error("benchmark failure");
+    keep(err);
+  }
+}
+
+void bench_new_error_no_trace(std::uint64_t iters) {
+  errors::set_max_trace_depth(0);
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error err = errors::new_error("benchmark failure");
+    keep(err);
+  }
+  errors::set_max_trace_depth(32);
+}
+
+void bench_new_error_pooled(std::uint64_t iters) {
+  errors::pool::reserve(16);
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error err = errors::new_error("benchmark failure");
+    keep(err);
+  }
+  errors::pool::drain();
+}
+
+void bench_wrap_depth(std::uint64_t iters, int depth) {
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error err = make_chain(depth);
+    keep(err);
+  }
+}
+
+void bench_is_deep_chain(std::uint64_t iters) {
+  errors::error err = errors::wrap(errors::error(kErrTimeout), "base");
+  for (int i = 0; i < 9; ++i) {
+    err = errors::wrap(std::move(err), "layer");
+  }
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    keep(errors::is(err, kErrTimeout));
+  }
+}
+
+void bench_has_category_deep_chain(std::uint64_t iters) {
+  errors::error err = errors::wrap(errors::error(kErrTimeout), "base");
+  for (int i = 0; i < 9; ++i) {
+    err = errors::wrap(std::move(err), "layer");
+  }
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    keep(errors::has_category(err, cat_timeout));
+  }
+}
+
+void bench_what_rendering(std::uint64_t iters) {
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error err = make_chain(5);
+    keep(std::strlen(err.what()));
+  }
+}
+
+void bench_format_to_buffer(std::uint64_t iters) {
+  errors::error err = make_chain(5);
+  char buffer[512];
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    keep(errors::format_to(err, std::span<char>(buffer)));
+  }
+}
+
+void bench_to_json(std::uint64_t iters) {
+  // A typical ~200-byte log line: two layers plus a longer detail string.
+  errors::error err = errors::wrap(
+      errors::new_error(std::string(
+          "upstream shard 14 returned HTTP 503 after 2 retries; request "
+          "abandoned because the deadline budget of 250ms was exhausted "
+          "while waiting on connection pool \"replica-east\"")),
+      "handle request");
+  std::string out;
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    out.clear();
+    errors::to_json(err, out);
+    keep(out.size());
+  }
+}
+
+void bench_serialize(std::uint64_t iters) {
+  errors::error err = make_chain(5);
+  std::string out;
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    out.clear();
+    errors::serialize(err, out);
+    keep(out.size());
+  }
+}
+
+void bench_deserialize(std::uint64_t iters) {
+  std::string wire = errors::serialize(make_chain(5));
+  for (std::uint64_t i = 0; i < iters; ++i) {
+    errors::error decoded;
+    keep(errors::deserialize(wire, decoded));
+    keep(decoded);
+  }
+}
+
+void bench_concurrent_creation(std::uint64_t iters, unsigned threads) {
+  std::uint64_t per_thread = iters / threads + 1;
+  std::vector<std::thread> workers;
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back([per_thread] {
+      for (std::uint64_t i = 0; i < per_thread; ++i) {
+        errors::error err = errors::new_error("concurrent failure");
+        keep(err);
+      }
+    });
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+}
+
+} // namespace
+
+int main() {
+  auto &reg = errors::bench::registry::instance();
+  reg.add("new_error", bench_new_error);
+  reg.add("new_error_no_trace", bench_new_error_no_trace);
+  reg.add("new_error_pooled", bench_new_error_pooled);
+  for (int depth : {1, 5, 10}) {
+    reg.add("wrap_depth_" + std::to_string(depth),
+            [depth](std::uint64_t iters) { bench_wrap_depth(iters, depth); });
+  }
+  reg.add("is_deep_chain", bench_is_deep_chain);
+  reg.add("has_category_deep_chain", bench_has_category_deep_chain);
+  reg.add("what_rendering", bench_what_rendering);
+  reg.add("format_to_buffer", bench_format_to_buffer);
+  reg.add("to_json", bench_to_json);
+  reg.add("serialize", bench_serialize);
+  reg.add("deserialize", bench_deserialize);
+  unsigned max_threads = std::thread::hardware_concurrency();
+  if (max_threads == 0) {
+    max_threads = 1;
+  }
+  for (unsigned threads = 1; threads <= 64 && threads <= max_threads * 2;
+       threads *= 2) {
+    reg.add("concurrent_creation_t" + std::to_string(threads),
+            [threads](std::uint64_t iters) {
+              bench_concurrent_creation(iters, threads);
+            });
+  }
+  errors::bench::emit_json(reg.run_all());
+  return 0;
+}
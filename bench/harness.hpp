@@ -0,0 +1,93 @@
+#ifndef ERRORS_BENCH_HARNESS_HPP
+#define ERRORS_BENCH_HARNESS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal micro-benchmark harness for errors_bench.
+//
+// The library has no external dependencies and neither does its
+// benchmark suite.  Each benchmark is a callable taking an iteration
+// count; the harness calibrates iterations until a run takes long
+// enough to measure, then reports ns/op.  Results are emitted as a JSON
+// array on stdout so releases can be diffed in dashboards.
+namespace errors::bench {
+
+struct result {
+  std::string name;
+  std::uint64_t iterations;
+  double ns_per_op;
+};
+
+class registry {
+public:
+  using fn = std::function<void(std::uint64_t iters)>;
+
+  static registry &instance() {
+    static registry r;
+    return r;
+  }
+
+  void add(std::string name, fn benchmark) {
+    benchmarks_.push_back({std::move(name), std::move(benchmark)});
+  }
+
+  std::vector<result> run_all() {
+    std::vector<result> results;
+    for (const auto &[name, benchmark] : benchmarks_) {
+      results.push_back(run_one(name, benchmark));
+    }
+    return results;
+  }
+
+private:
+  struct entry {
+    std::string name;
+    fn benchmark;
+  };
+
+  static result run_one(const std::string &name, const fn &benchmark) {
+    using clock = std::chrono::steady_clock;
+    constexpr double min_run_ns = 100e6; // 100ms per measured run
+    std::uint64_t iters = 1;
+    double elapsed_ns = 0;
+    for (;;) {
+      auto start = clock::now();
+      benchmark(iters);
+      elapsed_ns = std::chrono::duration<double, std::nano>(clock::now() -
+                                                            start)
+                       .count();
+      if (elapsed_ns >= min_run_ns || iters >= (1ULL << 30)) {
+        break;
+      }
+      // Aim past the threshold with headroom.
+      double scale = elapsed_ns > 0 ? (min_run_ns * 1.5) / elapsed_ns : 100;
+      std::uint64_t next = static_cast<std::uint64_t>(iters * scale);
+      iters = next > iters ? next : iters * 2;
+    }
+    return {name, iters, elapsed_ns / static_cast<double>(iters)};
+  }
+
+  std::vector<entry> benchmarks_;
+};
+
+inline void emit_json(const std::vector<result> &results) {
+  std::printf("[\n");
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const result &r = results[i];
+    std::printf("  {\"name\": \"%s\", \"iterations\": %llu, "
+                "\"ns_per_op\": %.2f}%s\n",
+                r.name.c_str(),
+                static_cast<unsigned long long>(r.iterations), r.ns_per_op,
+                i + 1 < results.size() ? "," : "");
+  }
+  std::printf("]\n");
+}
+
+} // namespace errors::bench
+
+#endif // ERRORS_BENCH_HARNESS_HPP
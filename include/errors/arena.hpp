@@ -0,0 +1,79 @@
+#ifndef ERRORS_ARENA_HPP
+#define ERRORS_ARENA_HPP
+
+#include <cstddef>
+#include <source_location>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// A bump allocator for error chains.
+///
+/// Services that build deep wrap chains per failed request can draw every
+/// node of a chain from one arena, so the whole chain lives in a handful
+/// of contiguous blocks and is released in a single operation instead of
+/// one free per level.  Chain traversal stays cache-friendly because
+/// consecutive wrap levels are adjacent in memory.
+///
+/// The arena must outlive every error drawn from it; reset() (or the
+/// destructor) runs pending finalizers and releases all blocks at once.
+/// Typical use scopes one arena to one request.
+///
+/// An arena is single-threaded: allocations from multiple threads must be
+/// externally synchronized (in practice, use one arena per request or per
+/// thread).
+class arena {
+public:
+  /// Creates an arena whose blocks hold block_size bytes of payload.
+  explicit arena(std::size_t block_size = 4096);
+
+  arena(const arena &) = delete;
+  arena &operator=(const arena &) = delete;
+
+  ~arena();
+
+  /// Allocates size bytes aligned to align.  Never returns nullptr; falls
+  /// back to a dedicated block for oversized requests.
+  void *allocate(std::size_t size, std::size_t align);
+
+  /// Registers fn(obj) to run on the next reset() (or destruction), in
+  /// reverse registration order.  Used to destroy non-trivial objects
+  /// placed in the arena.
+  void add_finalizer(void (*fn)(void *) noexcept, void *obj);
+
+  /// Runs pending finalizers and releases every block in one sweep.
+  /// All errors drawn from this arena become invalid.
+  void reset() noexcept;
+
+  /// Total bytes currently reserved in blocks (diagnostic).
+  std::size_t bytes_reserved() const noexcept;
+
+private:
+  struct block;
+  struct finalizer;
+
+  block *new_block(std::size_t payload_size);
+
+  block *head_ = nullptr;
+  finalizer *finalizers_ = nullptr;
+  std::size_t block_size_;
+};
+
+/// Like new_error(), but the node is placed in the arena; message bytes
+/// that do not fit the node's inline buffer are copied into the arena as
+/// well, so the chain needs no per-level heap allocation.  The arena must
+/// outlive the returned error.
+error new_error(arena &a, std::string_view message,
+                std::source_location origin = std::source_location::current());
+
+/// Like wrap(), but the wrapping node is placed in the arena.  Mixing is
+/// allowed: heap-backed causes inside the chain are still freed when the
+/// owning error is dropped, arena-backed ones when the arena is reset.
+error wrap(arena &a, error err, std::string_view message,
+           std::source_location origin = std::source_location::current());
+
+} // namespace errors
+
+#endif // ERRORS_ARENA_HPP
@@ -0,0 +1,88 @@
+#ifndef ERRORS_CONTEXT_HPP
+#define ERRORS_CONTEXT_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// A typed context value: int64, string, or bool.
+///
+/// Integers and bools are stored by value; strings are stored as
+/// non-owning views, so attaching the common two or three IDs to an
+/// error allocates nothing.  A string value (like a key) must outlive
+/// the error it is attached to — pass literals, interned strings, or
+/// request-scoped buffers.
+class context_value {
+public:
+  enum class kind : std::uint8_t { i64, str, boolean };
+
+  constexpr context_value(std::int64_t v) noexcept
+      : kind_(kind::i64), i64_(v) {}
+
+  constexpr context_value(std::string_view v) noexcept
+      : kind_(kind::str), str_{v.data(), v.size()} {}
+
+  // Constrained to exactly bool so integer arguments never fall into the
+  // boolean conversion and stay unambiguous.
+  template <std::same_as<bool> B>
+  constexpr context_value(B v) noexcept : kind_(kind::boolean), bool_(v) {}
+
+  constexpr kind type() const noexcept { return kind_; }
+
+  /// Value accessors; reading the wrong type returns a default.
+  constexpr std::int64_t as_int64() const noexcept {
+    return kind_ == kind::i64 ? i64_ : 0;
+  }
+  constexpr std::string_view as_string() const noexcept {
+    return kind_ == kind::str ? std::string_view{str_.data, str_.size}
+                              : std::string_view{};
+  }
+  constexpr bool as_bool() const noexcept {
+    return kind_ == kind::boolean && bool_;
+  }
+
+private:
+  kind kind_;
+  union {
+    std::int64_t i64_;
+    struct {
+      const char *data;
+      std::size_t size;
+    } str_;
+    bool bool_;
+  };
+};
+
+/// One attached key-value pair.  The key is a non-owning view with the
+/// same lifetime requirement as string values.
+struct context_pair {
+  std::string_view key;
+  context_value value;
+};
+
+/// Attaches a key-value pair to err's outermost node.  Takes and returns
+/// ownership, so call sites compose:
+///
+///   return errors::with_context(
+///       errors::with_context(errors::wrap(std::move(err), "lookup failed"),
+///                            "shard", std::int64_t(shard_id)),
+///       "retryable", true);
+///
+/// The first few pairs (four) are stored inline in the node; an
+/// arena-backed node spills further pairs into its arena, a heap node
+/// onto the heap.
+error with_context(error err, std::string_view key, context_value value);
+
+/// Pairs attached to err's outermost node, in attachment order.  Wrapping
+/// does not copy context upward: walk err.cause() to read inner nodes.
+/// The span is invalidated by the next with_context() on the same error.
+std::span<const context_pair> context(const error &err) noexcept;
+
+} // namespace errors
+
+#endif // ERRORS_CONTEXT_HPP
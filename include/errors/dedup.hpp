@@ -0,0 +1,79 @@
+#ifndef ERRORS_DEDUP_HPP
+#define ERRORS_DEDUP_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Receives deduplicated reports from a dedup_reporter.
+///
+/// on_report() runs on whichever thread triggered the emission (a
+/// reporting thread crossing a window boundary, or flush()), so it must
+/// be thread-safe.  occurrences is the number of duplicates aggregated
+/// since the previous emission for that key, the representative
+/// included.
+class report_sink {
+public:
+  virtual ~report_sink() = default;
+
+  virtual void on_report(const error &representative,
+                         std::uint64_t occurrences) = 0;
+};
+
+/// Aggregates duplicate errors before they hit the reporting pipeline.
+///
+/// During an incident the same failure (same capture site, same message)
+/// arrives millions of times; forwarding each one makes the logging
+/// pipeline the second outage.  report() keys errors on (capture site,
+/// message) in a sharded hash table: the first arrival of a key stores a
+/// representative, and every duplicate inside the configured window is a
+/// lock-free probe plus one relaxed increment — no lock, no allocation,
+/// no emission.  The first arrival of a key is emitted immediately (an
+/// incident should be observable from its first error) and kept as the
+/// representative; when a window expires the next reporting thread emits
+/// the representative with the count aggregated since and opens a new
+/// window.
+///
+/// Entries live until the reporter is destroyed (distinct keys are
+/// bounded by the program's error sites, not by error volume).  flush()
+/// and the destructor emit whatever is pending.
+class dedup_reporter {
+public:
+  explicit dedup_reporter(
+      report_sink &sink,
+      std::chrono::milliseconds window = std::chrono::milliseconds(1000));
+
+  dedup_reporter(const dedup_reporter &) = delete;
+  dedup_reporter &operator=(const dedup_reporter &) = delete;
+
+  /// Flushes pending aggregates.
+  ~dedup_reporter();
+
+  /// Reports err, taking ownership.  Emits immediately for the first
+  /// occurrence of a key; duplicates within the window are counted and
+  /// dropped.
+  void report(error err);
+
+  /// Emits every key with a pending count and restarts its window.
+  void flush();
+
+  /// Errors absorbed without an emission so far (duplicates inside a
+  /// window).
+  std::uint64_t suppressed() const noexcept;
+
+private:
+  struct shard;
+
+  shard *shard_of(std::uint64_t hash) const noexcept;
+
+  report_sink &sink_;
+  std::chrono::nanoseconds window_;
+  shard *shards_;
+};
+
+} // namespace errors
+
+#endif // ERRORS_DEDUP_HPP
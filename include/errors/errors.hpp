@@ -0,0 +1,398 @@
+#ifndef ERRORS_ERRORS_HPP
+#define ERRORS_ERRORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/// errors — a small error-value library for hot paths.
+///
+/// Errors are explicit values, not exceptions: errors::new_error() creates
+/// one, errors::wrap() adds a layer of context, and the chain is inspected
+/// with error::cause(), error::what() and error::trace().  Construction is
+/// designed to be cheap enough for request hot paths; anything expensive
+/// (symbolization, rendering) is deferred until the error is actually
+/// looked at.
+namespace errors {
+
+class arena;
+
+/// When trace symbolization happens.
+///
+/// Capturing a trace only copies raw instruction pointers (a fixed-size
+/// array copy, no allocation).  Under the default `lazy` policy the
+/// expensive symbol/source resolution runs on the first call to
+/// error::trace(); `eager` resolves at construction time for callers that
+/// want errors fully materialized up front (e.g. before crossing a
+/// deallocation boundary).
+enum class capture_policy : std::uint8_t {
+  lazy,
+  eager,
+  /// Capture a full trace for only 1-in-N errors per call site (see
+  /// set_trace_sample_rate()); the rest are created trace-less.  Keeps
+  /// error cost bounded during error storms, when tens of thousands of
+  /// identical errors per second would otherwise each pay for capture.
+  sampled,
+  /// Skip runtime unwinding entirely.  Every error still records its
+  /// origin (file, line, function) from the std::source_location baked
+  /// in at the call site at compile time, which is all most errors ever
+  /// display; full traces are reserved for errors explicitly created
+  /// with with_trace().
+  origin_only,
+};
+
+/// Sets the process-wide capture policy.  Defaults to capture_policy::lazy.
+void set_capture_policy(capture_policy policy) noexcept;
+
+/// Returns the current process-wide capture policy.
+capture_policy get_capture_policy() noexcept;
+
+/// Sets N for capture_policy::sampled: each call site captures a full
+/// trace for the first error it creates and then one per N.  Sampling
+/// state is thread-local (per-call-site counters, no atomics on the
+/// common path).  Defaults to 16; rate 0 or 1 means capture always.
+void set_trace_sample_rate(std::uint32_t rate) noexcept;
+
+/// Returns the current sampling rate.
+std::uint32_t get_trace_sample_rate() noexcept;
+
+/// Caps how many frames new_error()/wrap() capture per node.  Callers
+/// that only ever display the top 16 frames can halve capture cost by
+/// lowering this.  Values are clamped to the library's compiled-in
+/// maximum (32); the default is that maximum.
+void set_max_trace_depth(std::size_t depth) noexcept;
+
+/// Returns the current capture depth cap.
+std::size_t get_max_trace_depth() noexcept;
+
+/// Caps the memory the library will hold in live error chains; 0 (the
+/// default) disables the governor.  Under pressure the library degrades
+/// instead of growing: past ~75% of the budget new errors skip trace
+/// capture, past ~90% messages are also truncated to the in-node
+/// buffer, so an error storm costs bounded memory rather than an OOM.
+/// Accounting is approximate: each thread batches its allocation deltas
+/// and reconciles with one global counter every few kilobytes, so the
+/// common path is two thread-local arithmetic ops.
+void set_memory_budget(std::size_t bytes) noexcept;
+
+/// Returns the configured budget (0 = unlimited).
+std::size_t get_memory_budget() noexcept;
+
+/// Approximate bytes currently held by live error chains.  Lags by up
+/// to each thread's unflushed batch; see flush_memory_accounting().
+std::size_t approximate_memory_use() noexcept;
+
+/// Reconciles the calling thread's pending accounting batch immediately
+/// (threads also reconcile automatically every few kilobytes and at
+/// exit).
+void flush_memory_accounting() noexcept;
+
+
+/// One resolved stack frame of a captured trace.
+struct frame {
+  /// Instruction pointer as captured.
+  const void *ip = nullptr;
+  /// Demangled function name, or empty if resolution failed.
+  std::string function;
+  /// Object file (shared object or executable) containing ip.
+  std::string object;
+  /// Byte offset of ip into the containing object.
+  std::uintptr_t offset = 0;
+};
+
+/// A non-owning reference to a string with static storage duration (a
+/// string literal or other .rodata string).  Errors built from a
+/// static_string store the pointer directly: no copy at construction, no
+/// free at destruction.  The caller guarantees the referenced bytes
+/// outlive every error built from them.
+class static_string {
+public:
+  constexpr static_string() noexcept = default;
+
+  // Explicit: passing a plain const char* to new_error()/wrap() copies;
+  // wrapping it in static_string is the caller's assertion that the
+  // storage is immortal.
+  constexpr explicit static_string(const char *s) noexcept
+      : data_(s), size_(constexpr_length(s)) {}
+
+  constexpr static_string(const char *s, std::size_t size) noexcept
+      : data_(s), size_(size) {}
+
+  constexpr const char *data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+
+  constexpr operator std::string_view() const noexcept {
+    return {data_, size_};
+  }
+
+private:
+  static constexpr std::size_t constexpr_length(const char *s) noexcept {
+    std::size_t n = 0;
+    while (s[n] != '\0') {
+      ++n;
+    }
+    return n;
+  }
+
+  const char *data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+/// A bitmask classifying an error (timeout, retryable, auth failure,
+/// ...).  Applications define their own bits:
+///
+///   inline constexpr auto cat_timeout   = errors::category{1u << 0};
+///   inline constexpr auto cat_retryable = errors::category{1u << 1};
+///
+/// Category bits are OR-accumulated up the chain at wrap time, so asking
+/// "is anything in this chain a timeout" is a single AND on the
+/// outermost node — no chain walk, no virtual dispatch.
+enum class category : std::uint64_t { none = 0 };
+
+constexpr category operator|(category a, category b) noexcept {
+  return category{static_cast<std::uint64_t>(a) |
+                  static_cast<std::uint64_t>(b)};
+}
+
+constexpr category operator&(category a, category b) noexcept {
+  return category{static_cast<std::uint64_t>(a) &
+                  static_cast<std::uint64_t>(b)};
+}
+
+constexpr bool any(category c) noexcept {
+  return c != category::none;
+}
+
+/// A compile-time error sentinel.
+///
+/// Sentinels like ERR_TIMEOUT / ERR_NOT_FOUND are compared by identity,
+/// not by message; declaring them as
+///
+///   inline constexpr errors::static_error ERR_TIMEOUT{"timeout"};
+///
+/// puts them in .rodata with zero runtime initialization (no guard
+/// variable, no heap).  An errors::error can hold a sentinel directly —
+/// `return ERR_TIMEOUT;` allocates nothing — and errors::is() against a
+/// sentinel is a pointer comparison.
+class static_error {
+public:
+  /// The message must be a NUL-terminated string with static storage
+  /// duration (normally a literal).
+  constexpr explicit static_error(const char *message) noexcept
+      : message_(message) {}
+
+  /// Sentinel carrying category bits; errors holding or wrapping it
+  /// inherit them.
+  constexpr static_error(const char *message, category categories) noexcept
+      : message_(message), categories_(categories) {}
+
+  constexpr std::string_view message() const noexcept { return message_; }
+
+  /// NUL-terminated message, suitable as a what() result.
+  constexpr const char *c_message() const noexcept { return message_.data(); }
+
+  constexpr category categories() const noexcept { return categories_; }
+
+private:
+  static_string message_;
+  category categories_ = category::none;
+};
+
+namespace detail {
+
+struct node;
+struct access;
+
+/// Drops one reference on a chain head, destroying each node whose last
+/// reference this was.
+void destroy(node *n) noexcept;
+
+} // namespace detail
+
+/// An error value.
+///
+/// Owns a chain of one or more nodes (the outermost message plus the
+/// wrapped causes).  Nodes are reference-counted, so a chain can be
+/// shared: share() hands out another owning handle for the cost of one
+/// atomic increment, and cause() returns an owning handle onto the tail
+/// of the chain.  Copying stays explicit (no copy constructor) so
+/// sharing never happens by accident.  A default-constructed error is
+/// "no error" and converts to false.
+class error {
+public:
+  error() noexcept = default;
+
+  /// Holds a reference to a static sentinel; allocates nothing and owns
+  /// nothing.  Implicit so functions returning errors::error can
+  /// `return ERR_TIMEOUT;`.
+  error(const static_error &sentinel) noexcept
+      : bits_(reinterpret_cast<std::uintptr_t>(&sentinel) | kStatic) {}
+
+  error(error &&other) noexcept : bits_(other.bits_) { other.bits_ = 0; }
+
+  error &operator=(error &&other) noexcept {
+    if (this != &other) {
+      reset();
+      bits_ = other.bits_;
+      other.bits_ = 0;
+    }
+    return *this;
+  }
+
+  error(const error &) = delete;
+  error &operator=(const error &) = delete;
+
+  ~error() { reset(); }
+
+  /// True if this holds an actual error.
+  explicit operator bool() const noexcept { return bits_ != 0; }
+
+  /// Renders the message chain as "outer: inner: innermost".
+  /// The result is cached on first call; the pointer stays valid for the
+  /// lifetime of the error.  Returns "" for an empty error.
+  const char *what() const noexcept;
+
+  /// Message of the outermost node only, without the wrapped causes.
+  std::string_view message() const noexcept;
+
+  /// Another owning handle onto this error's chain.  Costs one atomic
+  /// increment on the outermost node — broadcasting one failure to N
+  /// waiters is N increments, not N deep copies.  The shared parts
+  /// (messages, traces, the cause chain) are immutable; with_category()
+  /// and with_context() on a shared error copy-on-write a new head
+  /// instead of mutating what other holders see.
+  error share() const noexcept;
+
+  /// The error this one wraps (an owning handle onto the tail of the
+  /// chain), or an empty error if this is the innermost node.
+  error cause() const noexcept;
+
+  /// Symbolized stack trace captured at construction of the outermost
+  /// node.  Under capture_policy::lazy the first call performs the
+  /// resolution; subsequent calls return the cached frames.
+  std::span<const frame> trace() const;
+
+  /// Where the outermost node was created, recorded at compile time via
+  /// std::source_location — available under every capture policy,
+  /// including origin_only and sampled-out errors.  line() is 0 for
+  /// empty errors and sentinels.
+  std::source_location origin() const noexcept;
+
+private:
+  friend struct detail::access;
+
+  static constexpr std::uintptr_t kStatic = 1;
+  static constexpr std::uintptr_t kTagMask = kStatic;
+
+  explicit error(detail::node *n) noexcept
+      : bits_(reinterpret_cast<std::uintptr_t>(n)) {}
+
+  detail::node *node_ptr() const noexcept {
+    if ((bits_ & kStatic) != 0) {
+      return nullptr;
+    }
+    return reinterpret_cast<detail::node *>(bits_ & ~kTagMask);
+  }
+
+  const static_error *static_ptr() const noexcept {
+    if ((bits_ & kStatic) == 0) {
+      return nullptr;
+    }
+    return reinterpret_cast<const static_error *>(bits_ & ~kTagMask);
+  }
+
+  void reset() noexcept {
+    if (detail::node *n = node_ptr(); n != nullptr) {
+      detail::destroy(n);
+    }
+    bits_ = 0;
+  }
+
+  detail::node *release() noexcept {
+    detail::node *n = node_ptr();
+    bits_ = 0;
+    return n;
+  }
+
+  // Node or sentinel pointer with the sentinel tag in the low bit;
+  // pointer-sized so moving an error is a single word swap.
+  std::uintptr_t bits_ = 0;
+};
+
+// Guaranteed for async code: propagating an error across a coroutine or
+// callback boundary is one noexcept word move, never a chain copy.
+// Anything widening the handle or adding a throwing move is an API
+// break, not a refactor.
+static_assert(sizeof(error) == sizeof(void *));
+static_assert(std::is_nothrow_move_constructible_v<error> &&
+              std::is_nothrow_move_assignable_v<error>);
+
+/// Captures raw instruction pointers of the current stack into out and
+/// returns the number written.  Allocation-free and async-signal-safe:
+/// usable inside signal handlers and fatal-path hooks where new_error()
+/// is not (the unwinder is warmed up once at library load so no lazy
+/// initialization happens here).  Build an inspectable error from the
+/// result later, on a normal thread, with from_raw_capture().
+std::size_t capture_raw(std::span<void *> out) noexcept;
+
+/// Builds an error carrying a previously captured raw trace (see
+/// capture_raw()).  Not async-signal-safe; call on a normal thread.
+/// Frames beyond the library's compiled-in maximum are dropped.
+error from_raw_capture(std::span<void *const> frames, std::string message);
+
+/// Creates a new error with the given message and a captured stack trace.
+/// Short messages are stored inline in the node; an rvalue std::string
+/// with a heap buffer is moved, not copied.
+error new_error(std::string message,
+                std::source_location origin = std::source_location::current());
+
+/// Creates a new error whose message is a zero-copy reference to static
+/// storage.
+error new_error(static_string message,
+                std::source_location origin = std::source_location::current());
+
+/// Creates a new error with a full stack trace regardless of the capture
+/// policy — the explicit opt-in that pairs with
+/// capture_policy::origin_only.
+error with_trace(std::string message,
+                 std::source_location origin = std::source_location::current());
+
+/// Wraps err with an additional layer of context.  Takes ownership of err;
+/// the returned error owns the whole chain.  Wrapping an empty error is
+/// equivalent to new_error(message).
+error wrap(error err, std::string message,
+           std::source_location origin = std::source_location::current());
+
+/// Zero-copy overload of wrap() for static messages.
+error wrap(error err, static_string message,
+           std::source_location origin = std::source_location::current());
+
+/// Tags err with category bits (OR'd into its accumulated mask).  Takes
+/// and returns ownership, so call sites compose:
+///   return errors::with_category(errors::wrap(...), cat_retryable);
+error with_category(error err, category c);
+
+/// Accumulated category mask of the whole chain, read off the outermost
+/// node in O(1).
+category categories(const error &err) noexcept;
+
+/// True if any bit of mask is set anywhere in the chain.  A single AND
+/// against the outermost node's accumulated mask.
+bool has_category(const error &err, category mask) noexcept;
+
+/// True if target's outermost node appears anywhere in err's chain.
+/// Comparison is by identity, not message equality.
+bool is(const error &err, const error &target) noexcept;
+
+/// True if the sentinel appears anywhere in err's chain.  A pointer
+/// comparison when err holds the sentinel directly.
+bool is(const error &err, const static_error &target) noexcept;
+
+} // namespace errors
+
+#endif // ERRORS_ERRORS_HPP
@@ -0,0 +1,140 @@
+#ifndef ERRORS_EXPECTED_HPP
+#define ERRORS_EXPECTED_HPP
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// A value-or-error result built around errors::error.
+///
+/// Designed for async call chains: moving an expected moves the payload
+/// and swaps one word for the error, so a failure bubbling through
+/// twenty coroutine frames costs twenty pointer moves, never a chain
+/// copy.  Implicit construction from error (and from a static sentinel)
+/// keeps return sites terse:
+///
+///   errors::expected<buffer> read(int fd) {
+///     if (fd < 0) return errors::new_error("bad fd");
+///     ...
+///     co_return std::move(buf);
+///   }
+///
+/// Like error itself, expected is move-only.
+template <typename T>
+class expected {
+public:
+  /// Success.  Implicit so plain `return value;` works.
+  expected(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : has_value_(true) {
+    new (&value_) T(std::move(value));
+  }
+
+  /// Failure.  Takes ownership of the chain; an empty error still counts
+  /// as a failure state (a caller returning an error meant one).
+  expected(error err) noexcept : has_value_(false) {
+    new (&error_) error(std::move(err));
+  }
+
+  expected(const static_error &sentinel) noexcept : has_value_(false) {
+    new (&error_) error(sentinel);
+  }
+
+  expected(expected &&other) noexcept(std::is_nothrow_move_constructible_v<T>)
+      : has_value_(other.has_value_) {
+    if (has_value_) {
+      new (&value_) T(std::move(other.value_));
+    } else {
+      new (&error_) error(std::move(other.error_));
+    }
+  }
+
+  expected &operator=(expected &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+      destroy();
+      has_value_ = other.has_value_;
+      if (has_value_) {
+        new (&value_) T(std::move(other.value_));
+      } else {
+        new (&error_) error(std::move(other.error_));
+      }
+    }
+    return *this;
+  }
+
+  expected(const expected &) = delete;
+  expected &operator=(const expected &) = delete;
+
+  ~expected() { destroy(); }
+
+  /// True on success.
+  bool has_value() const noexcept { return has_value_; }
+  explicit operator bool() const noexcept { return has_value_; }
+
+  /// The value; only valid when has_value().
+  T &value() & noexcept { return value_; }
+  const T &value() const & noexcept { return value_; }
+  T &&value() && noexcept { return std::move(value_); }
+
+  T *operator->() noexcept { return &value_; }
+  const T *operator->() const noexcept { return &value_; }
+  T &operator*() & noexcept { return value_; }
+  const T &operator*() const & noexcept { return value_; }
+  T &&operator*() && noexcept { return std::move(value_); }
+
+  /// The error; only valid when !has_value().
+  const error &err() const & noexcept { return error_; }
+
+  /// Moves the error out for re-wrapping or propagation:
+  ///   if (!r) return errors::wrap(std::move(r).take_error(), "stage 2");
+  error take_error() && noexcept { return std::move(error_); }
+
+private:
+  void destroy() noexcept {
+    if (has_value_) {
+      value_.~T();
+    } else {
+      error_.~error();
+    }
+  }
+
+  bool has_value_;
+  union {
+    T value_;
+    error error_;
+  };
+};
+
+/// expected<void>: success carries nothing; otherwise identical.
+template <>
+class expected<void> {
+public:
+  expected() noexcept : error_() {}
+
+  expected(error err) noexcept : error_(std::move(err)) {}
+
+  expected(const static_error &sentinel) noexcept : error_(sentinel) {}
+
+  expected(expected &&) noexcept = default;
+  expected &operator=(expected &&) noexcept = default;
+
+  expected(const expected &) = delete;
+  expected &operator=(const expected &) = delete;
+
+  bool has_value() const noexcept { return !error_; }
+  explicit operator bool() const noexcept { return !error_; }
+
+  const error &err() const & noexcept { return error_; }
+  error take_error() && noexcept { return std::move(error_); }
+
+private:
+  error error_;
+};
+
+} // namespace errors
+
+#endif // ERRORS_EXPECTED_HPP
@@ -0,0 +1,47 @@
+#ifndef ERRORS_FLIGHT_HPP
+#define ERRORS_FLIGHT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace errors {
+
+/// One flight-recorder entry: a fixed-size digest of an error creation,
+/// compact enough to record on every new_error()/wrap() call.
+struct flight_record {
+  /// Steady-clock nanoseconds; orders records across threads.
+  std::uint64_t timestamp_ns = 0;
+  /// The new_error()/wrap() call site (return address), resolvable with
+  /// the symbolizer or a symbol index.
+  const void *site = nullptr;
+  /// Category bits at creation time.
+  std::uint64_t categories = 0;
+  /// Message intern ID (see errors/intern.hpp), 0 when not interned.
+  std::uint32_t intern_id = 0;
+  /// Recorder-assigned thread number, stable for the thread's lifetime.
+  std::uint32_t thread = 0;
+};
+
+/// Switches on always-on error recording: every subsequent error
+/// creation appends a flight_record to the calling thread's private
+/// ring of ring_capacity entries (rounded up to a power of two; applies
+/// to rings created after this call — a thread's ring is sized when it
+/// records its first error).  The
+/// hot path is a handful of relaxed stores into thread-local memory —
+/// no locks, no contention, bounded memory per thread.
+void enable_flight_recorder(std::size_t ring_capacity = 256);
+
+/// Stops recording.  Already-recorded entries remain visible to
+/// flight_snapshot().
+void disable_flight_recorder();
+
+/// Stitches every thread's ring (including rings retired by exited
+/// threads) into one timeline, oldest first.  Safe to call from any
+/// thread while recording continues; entries overwritten mid-read are
+/// skipped rather than returned torn.
+std::vector<flight_record> flight_snapshot();
+
+} // namespace errors
+
+#endif // ERRORS_FLIGHT_HPP
@@ -0,0 +1,185 @@
+#ifndef ERRORS_FMT_HPP
+#define ERRORS_FMT_HPP
+
+#include <charconv>
+#include <cstddef>
+#include <source_location>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+namespace detail {
+
+// Render target for wrap_fmt: arguments format into an in-place buffer
+// sized for typical wrap messages, so the common case touches no heap
+// before the bytes land in the node's inline storage; oversized results
+// spill to a string.
+class fmt_sink {
+public:
+  void append(std::string_view s) {
+    if (!spilled_ && used_ + s.size() <= sizeof(inline_)) {
+      std::char_traits<char>::copy(inline_ + used_, s.data(), s.size());
+      used_ += s.size();
+      return;
+    }
+    spill(s);
+  }
+
+  void push(char c) { append({&c, 1}); }
+
+  std::string_view view() const noexcept {
+    return spilled_ ? std::string_view(spill_)
+                    : std::string_view(inline_, used_);
+  }
+
+private:
+  void spill(std::string_view s) {
+    if (!spilled_) {
+      spill_.reserve(used_ + s.size());
+      spill_.append(inline_, used_);
+      spilled_ = true;
+    }
+    spill_.append(s);
+  }
+
+  char inline_[192];
+  std::size_t used_ = 0;
+  bool spilled_ = false;
+  std::string spill_;
+};
+
+// One type-erased argument: a pointer to the caller's value plus a
+// renderer instantiated for its type.  The array form keeps the format
+// loop out of the header.
+struct fmt_arg {
+  const void *value;
+  void (*render)(fmt_sink &sink, const void *value);
+};
+
+template <typename T>
+void render_fmt_arg(fmt_sink &sink, const void *value) {
+  const T &v = *static_cast<const T *>(value);
+  if constexpr (std::is_same_v<T, bool>) {
+    sink.append(v ? "true" : "false");
+  } else if constexpr (std::is_same_v<T, char>) {
+    sink.push(v);
+  } else if constexpr (std::is_integral_v<T>) {
+    char buf[24];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), v);
+    sink.append({buf, static_cast<std::size_t>(end - buf)});
+  } else if constexpr (std::is_floating_point_v<T>) {
+    char buf[32];
+    auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), v);
+    sink.append({buf, static_cast<std::size_t>(end - buf)});
+  } else {
+    static_assert(std::is_convertible_v<const T &, std::string_view>,
+                  "wrap_fmt arguments must be arithmetic or string-like");
+    sink.append(std::string_view(v));
+  }
+}
+
+/// Runs the format loop: literal runs plus "{}" holes, with "{{"/"}}"
+/// escapes.  The hole count was validated at compile time.
+void vformat(fmt_sink &sink, const char *fmt, std::span<const fmt_arg> args);
+
+error wrap_rendered(error err, std::string_view message,
+                    std::source_location origin);
+error wrap_rendered(arena &a, error err, std::string_view message,
+                    std::source_location origin);
+
+} // namespace detail
+
+/// A format string checked at compile time: construction is consteval
+/// and fails to compile unless every brace is either a "{}" hole
+/// matching one argument or a "{{"/"}}" escape.  The creating call
+/// site's std::source_location is captured alongside.
+template <typename... Args>
+class fmt_string {
+public:
+  consteval fmt_string(
+      const char *str,
+      std::source_location origin = std::source_location::current())
+      : str_(str), origin_(origin) {
+    std::size_t holes = 0;
+    for (const char *p = str; *p != '\0'; ++p) {
+      if (*p == '{') {
+        if (p[1] == '{') {
+          ++p;
+        } else if (p[1] == '}') {
+          ++holes;
+          ++p;
+        } else {
+          invalid_format_string();
+        }
+      } else if (*p == '}') {
+        if (p[1] == '}') {
+          ++p;
+        } else {
+          invalid_format_string();
+        }
+      }
+    }
+    if (holes != sizeof...(Args)) {
+      invalid_format_string();
+    }
+  }
+
+  const char *get() const noexcept { return str_; }
+  std::source_location origin() const noexcept { return origin_; }
+
+private:
+  // Not constexpr: calling it in the consteval constructor is the
+  // compile error that rejects a malformed format string.
+  static void invalid_format_string();
+
+  const char *str_;
+  std::source_location origin_;
+};
+
+/// Like wrap(), but the message is formatted fmt-style straight into the
+/// error's storage:
+///
+///   return errors::wrap_fmt(std::move(err), "shard {} failed", shard_id);
+///
+/// The format string is parsed at compile time (hole count checked
+/// against the arguments), and rendering writes into an in-place buffer
+/// that lands in the node's inline storage — no throwaway std::string
+/// per wrap.  Supported arguments: integers, floats, bool, char, and
+/// anything convertible to std::string_view.
+template <typename... Args>
+error wrap_fmt(error err,
+               fmt_string<std::type_identity_t<Args>...> fmt,
+               const Args &...args) {
+  detail::fmt_sink sink;
+  const detail::fmt_arg erased[] = {
+      detail::fmt_arg{&args, &detail::render_fmt_arg<Args>}...,
+      detail::fmt_arg{nullptr, nullptr}};
+  detail::vformat(sink, fmt.get(),
+                  std::span<const detail::fmt_arg>(erased, sizeof...(Args)));
+  return detail::wrap_rendered(std::move(err), sink.view(), fmt.origin());
+}
+
+/// Arena-backed variant: the wrapping node and any oversized message
+/// bytes are drawn from a (see errors/arena.hpp).
+template <typename... Args>
+error wrap_fmt(arena &a, error err,
+               fmt_string<std::type_identity_t<Args>...> fmt,
+               const Args &...args) {
+  detail::fmt_sink sink;
+  const detail::fmt_arg erased[] = {
+      detail::fmt_arg{&args, &detail::render_fmt_arg<Args>}...,
+      detail::fmt_arg{nullptr, nullptr}};
+  detail::vformat(sink, fmt.get(),
+                  std::span<const detail::fmt_arg>(erased, sizeof...(Args)));
+  return detail::wrap_rendered(a, std::move(err), sink.view(), fmt.origin());
+}
+
+} // namespace errors
+
+#endif // ERRORS_FMT_HPP
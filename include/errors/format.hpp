@@ -0,0 +1,60 @@
+#ifndef ERRORS_FORMAT_HPP
+#define ERRORS_FORMAT_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "errors/errors.hpp"
+#include "errors/observe.hpp"
+
+namespace errors {
+
+namespace detail {
+
+/// Streams the rendered pieces of err ("outer", ": ", "inner", ...) to
+/// emit in order.  The callback form keeps the chain walk in one place
+/// without std::function allocation.
+void render_pieces(const error &err,
+                   void (*emit)(void *ctx, std::string_view piece),
+                   void *ctx);
+
+} // namespace detail
+
+/// Exact number of bytes the rendered chain occupies ("outer: inner:
+/// ..."), so callers can reserve once before formatting.
+std::size_t rendered_size(const error &err) noexcept;
+
+/// Renders err's chain directly into buffer with no intermediate
+/// allocation.  Returns the number of bytes written; output is truncated
+/// if buffer is smaller than rendered_size(err).  No NUL terminator is
+/// written.
+std::size_t format_to(const error &err, std::span<char> buffer) noexcept;
+
+/// Appends the rendered chain to out, reserving the exact final size
+/// first; one allocation at most, zero if out has capacity.
+void format_append(const error &err, std::string &out);
+
+/// Streams the rendered chain into an output iterator (fmt-style sinks,
+/// back_inserter, ...).  Allocation behavior is the iterator's.
+template <typename OutputIt>
+  requires std::output_iterator<OutputIt, char>
+OutputIt format_to(const error &err, OutputIt out) {
+  detail::note_render();
+  detail::render_pieces(
+      err,
+      [](void *ctx, std::string_view piece) {
+        auto &it = *static_cast<OutputIt *>(ctx);
+        for (char c : piece) {
+          *it++ = c;
+        }
+      },
+      &out);
+  return out;
+}
+
+} // namespace errors
+
+#endif // ERRORS_FORMAT_HPP
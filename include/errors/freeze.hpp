@@ -0,0 +1,78 @@
+#ifndef ERRORS_FREEZE_HPP
+#define ERRORS_FREEZE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+
+#include "errors/context.hpp"
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// An immutable, flattened snapshot of an error chain in one allocation.
+///
+/// freeze() lays the whole chain — per-level messages, context pairs and
+/// raw trace addresses — out contiguously, linked by offsets instead of
+/// pointers.  Compared to holding the live error, a frozen_error is
+/// cheaper to keep in a retry queue (one exact-sized allocation instead
+/// of the chain's allocation graph), faster to walk repeatedly
+/// (sequential memory), and position-independent: bytes() can be written
+/// to a persistent log verbatim and revived later with from_bytes().
+///
+/// Levels are ordered outermost first; a sentinel terminating the chain
+/// appears as the innermost level.
+class frozen_error {
+public:
+  frozen_error() noexcept = default;
+
+  frozen_error(frozen_error &&) noexcept = default;
+  frozen_error &operator=(frozen_error &&) noexcept = default;
+
+  frozen_error(const frozen_error &) = delete;
+  frozen_error &operator=(const frozen_error &) = delete;
+
+  /// Number of chain levels; 0 for a frozen empty error.
+  std::size_t depth() const noexcept;
+  explicit operator bool() const noexcept { return depth() != 0; }
+
+  /// Message of one level (may be empty for tagging levels).
+  std::string_view message(std::size_t level) const noexcept;
+
+  /// Accumulated category mask (as read off the outermost level).
+  category categories() const noexcept;
+
+  /// Raw captured instruction pointers of one level.
+  std::span<const std::uint64_t> trace(std::size_t level) const noexcept;
+
+  /// Context pairs of one level.  Views point into the frozen buffer and
+  /// stay valid as long as this frozen_error lives.
+  std::size_t context_count(std::size_t level) const noexcept;
+  context_pair context(std::size_t level, std::size_t i) const noexcept;
+
+  /// The chain rendered "outer: inner", matching error::what().
+  std::string to_string() const;
+
+  /// The underlying buffer, suitable for writing to a log verbatim.
+  std::span<const std::byte> bytes() const noexcept;
+
+  /// Revives a frozen error from bytes() output (the bytes are copied).
+  /// Returns an empty frozen_error when data is not a valid snapshot.
+  static frozen_error from_bytes(std::span<const std::byte> data);
+
+private:
+  friend frozen_error freeze(const error &err);
+
+  std::unique_ptr<std::byte[]> buffer_;
+  std::size_t size_ = 0;
+};
+
+/// Flattens err into a frozen_error.  The live error is unchanged;
+/// traces are frozen raw (unsymbolized), exactly as captured.
+frozen_error freeze(const error &err);
+
+} // namespace errors
+
+#endif // ERRORS_FREEZE_HPP
@@ -0,0 +1,39 @@
+#ifndef ERRORS_INTERN_HPP
+#define ERRORS_INTERN_HPP
+
+#include <cstdint>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Opt-in message interning.
+///
+/// Fleets produce the same few hundred distinct messages billions of
+/// times; with interning enabled, new_error()/wrap() look the message up
+/// in a process-wide lock-free, append-only string table and the node
+/// stores a 32-bit intern ID instead of a copy, shrinking per-error
+/// message storage to 4 bytes and making message equality an integer
+/// compare via message_id().
+///
+/// The table is bounded; once full, further distinct messages fall back
+/// to normal storage.  Interned strings live for the process lifetime.
+void set_message_interning(bool enabled) noexcept;
+
+bool message_interning_enabled() noexcept;
+
+/// Intern ID of err's outermost message, or 0 if it is not interned.
+/// Equal IDs imply equal messages (and unequal nonzero IDs, unequal
+/// messages).
+std::uint32_t message_id(const error &err) noexcept;
+
+/// The string for an intern ID; empty for 0 or unknown IDs.
+std::string_view interned_message(std::uint32_t id) noexcept;
+
+/// Number of distinct messages interned so far.
+std::size_t interned_message_count() noexcept;
+
+} // namespace errors
+
+#endif // ERRORS_INTERN_HPP
@@ -0,0 +1,62 @@
+#ifndef ERRORS_JOIN_HPP
+#define ERRORS_JOIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Collects per-shard failures from concurrent workers.
+///
+/// add() is a lock-free multi-producer push (a CAS on an atomic list
+/// head), so N workers reporting failures never serialize on a lock and
+/// no string work happens until the collector asks for the result.
+/// Consumption (collapse(), take_all()) is single-consumer: call it after
+/// the producing workers are done.
+class join {
+public:
+  join() = default;
+
+  join(const join &) = delete;
+  join &operator=(const join &) = delete;
+
+  ~join();
+
+  /// Appends err to the collection.  Empty errors are ignored, so callers
+  /// can push unconditionally.  Safe to call from any number of threads
+  /// concurrently; never blocks on other producers.
+  void add(error err) noexcept;
+
+  /// Number of errors collected so far (approximate while producers are
+  /// still running).
+  std::size_t size() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  /// Collapses everything collected into one error and clears the
+  /// collection.  The combined message ("err1; err2; ...") is rendered
+  /// here — not in add() — once, in arrival order.  Returns an empty
+  /// error if nothing was collected.
+  error collapse();
+
+  /// Removes and returns the collected errors in arrival order, for
+  /// callers that need per-shard structure instead of one message.
+  std::vector<error> take_all();
+
+private:
+  struct entry;
+
+  entry *take_entries_reversed() noexcept;
+
+  std::atomic<entry *> head_{nullptr};
+  std::atomic<std::size_t> count_{0};
+};
+
+} // namespace errors
+
+#endif // ERRORS_JOIN_HPP
@@ -0,0 +1,31 @@
+#ifndef ERRORS_JSON_HPP
+#define ERRORS_JSON_HPP
+
+#include <string>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Appends err as one JSON object to out, shaped for structured log
+/// pipelines:
+///
+///   {"message":"outer: inner","chain":["outer","inner"],
+///    "categories":3,"context":{"shard":42},"origin":{"file":...,"line":...}}
+///
+/// chain holds the per-level messages; categories, context (the
+/// outermost node's pairs) and origin appear only when present.  An
+/// empty error renders as {}.
+///
+/// String escaping scans 16 bytes at a time (SSE2) for the rare byte
+/// that needs an escape and bulk-copies the clean runs between them, so
+/// rendering a typical log line runs at copy speed rather than
+/// byte-at-a-time.
+void to_json(const error &err, std::string &out);
+
+/// Convenience form returning a fresh string.
+std::string to_json(const error &err);
+
+} // namespace errors
+
+#endif // ERRORS_JSON_HPP
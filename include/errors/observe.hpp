@@ -0,0 +1,46 @@
+#ifndef ERRORS_OBSERVE_HPP
+#define ERRORS_OBSERVE_HPP
+
+#include <cstdint>
+
+namespace errors {
+
+/// Receives preaggregated event counts from the library.
+///
+/// To keep the hot path cheap the library never invokes the observer per
+/// event: each thread accumulates counts locally and flushes them as a
+/// batch (every few hundred events, at thread exit, and on
+/// flush_observed_events()).  Callbacks therefore run on arbitrary
+/// threads and must be thread-safe; deltas are counts since the previous
+/// flush from that thread.
+class observer {
+public:
+  virtual ~observer() = default;
+
+  virtual void on_create(std::uint64_t count) = 0;
+  virtual void on_wrap(std::uint64_t count) = 0;
+  virtual void on_render(std::uint64_t count) = 0;
+};
+
+/// Installs obs as the process-wide observer (nullptr disables).  The
+/// observer must outlive its installation; swap to nullptr and flush
+/// before destroying it.  With no observer installed the per-event cost
+/// is a single relaxed load and a not-taken branch.
+void set_observer(observer *obs) noexcept;
+
+/// Flushes the calling thread's pending counts to the installed
+/// observer immediately.
+void flush_observed_events() noexcept;
+
+namespace detail {
+
+// Hot-path hooks; see observe.cpp.
+void note_create() noexcept;
+void note_wrap() noexcept;
+void note_render() noexcept;
+
+} // namespace detail
+
+} // namespace errors
+
+#endif // ERRORS_OBSERVE_HPP
@@ -0,0 +1,37 @@
+#ifndef ERRORS_POOL_HPP
+#define ERRORS_POOL_HPP
+
+#include <cstddef>
+
+namespace errors {
+
+/// A thread-local freelist of fixed-size error nodes.
+///
+/// Once a thread has called reserve(), new_error() and wrap() on that
+/// thread take nodes from its freelist and destruction returns them, so
+/// error creation on the hot path is a pop, destruction is a push, and
+/// neither touches malloc/free or any cross-thread synchronization.
+///
+/// Nodes may be destroyed on a different thread than the one that created
+/// them; they are then pushed onto the destroying thread's freelist.  When
+/// the freelist is empty (or reserve() was never called) allocation falls
+/// back to the heap.
+class pool {
+public:
+  pool() = delete;
+
+  /// Preallocates count nodes on the calling thread's freelist.
+  static void reserve(std::size_t count);
+
+  /// Number of nodes currently sitting on the calling thread's freelist.
+  static std::size_t available() noexcept;
+
+  /// Releases the calling thread's freelist back to the heap.  Nodes
+  /// currently in use are unaffected; they rejoin a freelist when their
+  /// error is destroyed.
+  static void drain() noexcept;
+};
+
+} // namespace errors
+
+#endif // ERRORS_POOL_HPP
@@ -0,0 +1,44 @@
+#ifndef ERRORS_REGISTRY_HPP
+#define ERRORS_REGISTRY_HPP
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Metadata for a registered error domain, looked up by numeric code
+/// when classifying errors at process edges.
+struct domain_info {
+  std::uint64_t code = 0;
+  /// Domain name; the registry owns a copy, valid for the process
+  /// lifetime.
+  std::string_view name;
+  /// Categories implied by the code (retryability etc.).
+  category categories = category::none;
+};
+
+/// Registers (or re-registers) a domain under code.  Codes must be
+/// nonzero.  Registration takes a lock and rebuilds an immutable lookup
+/// snapshot — it is meant for startup, not hot paths.
+void register_domain(std::uint64_t code, std::string_view name,
+                     category categories = category::none);
+
+/// Registers a whole batch in one snapshot rebuild.  Prefer this for
+/// startup registration: N register_domain() calls rebuild N snapshots,
+/// this builds one.  Entries with code 0 are skipped.
+void register_domains(std::span<const domain_info> domains);
+
+/// Looks up the domain registered under code, or nullptr.
+///
+/// Wait-free: one atomic snapshot load plus an open-addressing probe,
+/// with each slot on its own cache line.  The returned pointer stays
+/// valid for the process lifetime, even across later registrations
+/// (snapshots are immutable once published).
+const domain_info *find_domain(std::uint64_t code) noexcept;
+
+} // namespace errors
+
+#endif // ERRORS_REGISTRY_HPP
@@ -0,0 +1,60 @@
+#ifndef ERRORS_SERIALIZE_HPP
+#define ERRORS_SERIALIZE_HPP
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Returned by deserialize() when the input is not a valid wire chain.
+inline constexpr static_error bad_wire_format{"malformed error wire format"};
+
+/// Appends a compact, length-prefixed binary encoding of err's chain to
+/// out.  The format is structural: each level's message and raw trace
+/// addresses survive the round trip without text rendering/reparsing.
+/// Raw trace addresses are only meaningful to consumers sharing the
+/// producing binary (or a symbol index for it).
+void serialize(const error &err, std::string &out);
+
+/// Convenience overload returning the encoded bytes.
+std::string serialize(const error &err);
+
+/// Reconstructs an error chain from buffer into out.
+///
+/// Deserialization is zero-copy: the reconstructed nodes keep views into
+/// buffer for all message bytes, so forwarding an error through a proxy
+/// costs one buffer copy at most.  The caller must keep buffer alive and
+/// unchanged for the lifetime of out (and anything wrapped around it).
+///
+/// Returns an empty error on success, or bad_wire_format (wrapped with
+/// detail) if buffer is truncated or corrupt; out is left empty then.
+error deserialize(std::string_view buffer, error &out);
+
+/// Appends a single framed stream encoding every error in batch to out.
+///
+/// Shared data is written once and back-referenced: each distinct
+/// message lands in a string table, and traces are stored as a tree of
+/// (parent, address) entries so the common main-side prefix of traces
+/// captured below the same call path costs one entry per frame for the
+/// whole batch, not per error.  The result is one contiguous buffer —
+/// flush it with a single write instead of thousands of per-error ones.
+void serialize_batch(std::span<const error> batch, std::string &out);
+
+/// Convenience overload returning the encoded bytes.
+std::string serialize_batch(std::span<const error> batch);
+
+/// Reconstructs every error of a serialize_batch() stream into out
+/// (cleared first).  Zero-copy like deserialize(): message bytes stay
+/// views into buffer, which must outlive the reconstructed errors.
+///
+/// Returns an empty error on success, or bad_wire_format (wrapped with
+/// detail) if buffer is truncated or corrupt; out is left empty then.
+error deserialize_batch(std::string_view buffer, std::vector<error> &out);
+
+} // namespace errors
+
+#endif // ERRORS_SERIALIZE_HPP
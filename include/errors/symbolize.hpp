@@ -0,0 +1,46 @@
+#ifndef ERRORS_SYMBOLIZE_HPP
+#define ERRORS_SYMBOLIZE_HPP
+
+#include <cstdint>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors {
+
+/// Loads a symbol index produced by the errors-symindex build tool and
+/// memory-maps it for the symbolizer.
+///
+/// With an index loaded, resolving an instruction pointer inside the
+/// indexed binary is a binary search over the mapping — function names
+/// are stored pre-demangled, so the first error::trace() after process
+/// start costs microseconds instead of a full symbol-table walk, and the
+/// index pages in on demand so resident memory stays low.  Addresses not
+/// covered by the index fall back to the normal dladdr path.
+///
+/// Returns an empty error on success.  The mapping lives for the process
+/// lifetime; loading a second index replaces the first.
+error load_symbol_index(std::string_view path);
+
+/// Counters for the process-wide symbolization cache behind
+/// error::trace().  Monotonic since process start; reads are relaxed and
+/// cheap, intended for metrics export.
+struct symbolizer_stats {
+  /// Instruction-pointer resolutions requested.
+  std::uint64_t lookups = 0;
+  /// Resolutions served from the cache without a symbol-table lookup.
+  std::uint64_t hits = 0;
+  /// Resolutions that could not be cached (cache shard full).
+  std::uint64_t uncached = 0;
+  /// Cache replicas, one per NUMA node detected at first symbolization.
+  /// Each socket fills and probes its own replica so resolution
+  /// throughput scales instead of plateauing on cross-socket coherence
+  /// traffic; 1 on single-node hosts.
+  std::size_t numa_replicas = 1;
+};
+
+symbolizer_stats get_symbolizer_stats() noexcept;
+
+} // namespace errors
+
+#endif // ERRORS_SYMBOLIZE_HPP
@@ -0,0 +1,90 @@
+#include "errors/arena.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace errors {
+
+struct alignas(std::max_align_t) arena::block {
+  block *next;
+  std::size_t capacity;
+  std::size_t used;
+  // Payload follows the header.
+  std::byte *data() noexcept {
+    return reinterpret_cast<std::byte *>(this + 1);
+  }
+};
+
+struct arena::finalizer {
+  finalizer *next;
+  void (*fn)(void *) noexcept;
+  void *obj;
+};
+
+arena::arena(std::size_t block_size) : block_size_(block_size) {}
+
+arena::~arena() { reset(); }
+
+arena::block *arena::new_block(std::size_t payload_size) {
+  void *mem = std::malloc(sizeof(block) + payload_size);
+  if (mem == nullptr) {
+    throw std::bad_alloc();
+  }
+  auto *b = static_cast<block *>(mem);
+  b->next = head_;
+  b->capacity = payload_size;
+  b->used = 0;
+  head_ = b;
+  return b;
+}
+
+void *arena::allocate(std::size_t size, std::size_t align) {
+  block *b = head_;
+  if (b != nullptr) {
+    // Block payloads are max_align_t-aligned, so aligning the offset
+    // aligns the pointer.
+    std::size_t aligned = (b->used + align - 1) & ~(align - 1);
+    if (aligned + size <= b->capacity) {
+      b->used = aligned + size;
+      return b->data() + aligned;
+    }
+  }
+  std::size_t payload = size > block_size_ ? size : block_size_;
+  b = new_block(payload);
+  b->used = size;
+  return b->data();
+}
+
+void arena::add_finalizer(void (*fn)(void *) noexcept, void *obj) {
+  auto *f = static_cast<finalizer *>(
+      allocate(sizeof(finalizer), alignof(finalizer)));
+  f->next = finalizers_;
+  f->fn = fn;
+  f->obj = obj;
+  finalizers_ = f;
+}
+
+void arena::reset() noexcept {
+  for (finalizer *f = finalizers_; f != nullptr; f = f->next) {
+    f->fn(f->obj);
+  }
+  finalizers_ = nullptr;
+  block *b = head_;
+  while (b != nullptr) {
+    block *next = b->next;
+    std::free(b);
+    b = next;
+  }
+  head_ = nullptr;
+}
+
+std::size_t arena::bytes_reserved() const noexcept {
+  std::size_t total = 0;
+  for (const block *b = head_; b != nullptr; b = b->next) {
+    total += b->capacity;
+  }
+  return total;
+}
+
+} // namespace errors
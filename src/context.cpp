@@ -0,0 +1,72 @@
+#include "errors/context.hpp"
+
+#include <cstring>
+#include <utility>
+
+#include "errors/arena.hpp"
+#include "node.hpp"
+
+namespace errors {
+
+namespace detail {
+
+context_store::~context_store() {
+  if (overflow_on_heap_) {
+    delete[] reinterpret_cast<unsigned char *>(overflow_);
+  }
+}
+
+void context_store::append(std::string_view key, context_value value,
+                           arena *a) {
+  if (count_ == capacity_) {
+    std::uint32_t grown = capacity_ * 2;
+    context_pair *fresh;
+    if (a != nullptr) {
+      // The previous overflow block stays behind in the arena; bump
+      // allocators don't free, and context rarely spills at all.
+      fresh = static_cast<context_pair *>(
+          a->allocate(grown * sizeof(context_pair), alignof(context_pair)));
+    } else {
+      fresh = reinterpret_cast<context_pair *>(
+          new unsigned char[grown * sizeof(context_pair)]);
+    }
+    std::memcpy(fresh, pairs().data(), count_ * sizeof(context_pair));
+    if (overflow_on_heap_) {
+      delete[] reinterpret_cast<unsigned char *>(overflow_);
+    }
+    overflow_ = fresh;
+    overflow_on_heap_ = a == nullptr;
+    capacity_ = grown;
+  }
+  context_pair *slot = overflow_ != nullptr ? overflow_ : inline_;
+  slot[count_++] = {key, value};
+}
+
+} // namespace detail
+
+error with_context(error err, std::string_view key, context_value value) {
+  detail::node *n = detail::access::get(err);
+  if (n == nullptr) {
+    if (detail::access::get_static(err) == nullptr) {
+      return err; // empty error: nothing to attach to
+    }
+    // Sentinels are immutable; wrap with an empty message to get a
+    // mutable head node (rendering skips empty messages).
+    err = wrap(std::move(err), static_string(), std::source_location());
+    n = detail::access::get(err);
+  } else if (n->shared()) {
+    // Copy-on-write: give this holder a private head so other holders of
+    // the shared chain don't see the new pair.
+    err = wrap(std::move(err), static_string(), std::source_location());
+    n = detail::access::get(err);
+  }
+  n->context.append(key, value, n->owner);
+  return err;
+}
+
+std::span<const context_pair> context(const error &err) noexcept {
+  const detail::node *n = detail::access::get(err);
+  return n != nullptr ? n->context.pairs() : std::span<const context_pair>();
+}
+
+} // namespace errors
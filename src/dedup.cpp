@@ -0,0 +1,183 @@
+#include "errors/dedup.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <utility>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+std::uint64_t fnv1a(std::string_view s) noexcept {
+  std::uint64_t h = 0xCBF29CE484222325ULL;
+  for (char c : s) {
+    h = (h ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+  }
+  return h;
+}
+
+// (capture site, message) key of an error: the innermost captured
+// instruction pointer pins the call site, the outermost message
+// distinguishes sites that raise different failures.  Interned messages
+// hash their 4-byte ID instead of the bytes.
+std::uint64_t key_of(const detail::node *n) noexcept {
+  std::uint64_t site =
+      n->trace.count > 0 ? reinterpret_cast<std::uint64_t>(n->trace.ips[0]) : 0;
+  std::uint64_t msg;
+  if (std::uint32_t id = n->message.intern_id(); id != 0) {
+    msg = 0x9E3779B97F4A7C15ULL * id;
+  } else {
+    msg = fnv1a(n->message.get());
+  }
+  // Mix so shard selection sees both halves of the key.
+  std::uint64_t h = site ^ (msg + 0x9E3779B97F4A7C15ULL + (site << 6));
+  return h != 0 ? h : 1;
+}
+
+std::int64_t now_ns() noexcept {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+constexpr std::size_t dedup_shards = 16;
+constexpr std::size_t dedup_slots = 512; // power of two, probed linearly
+
+} // namespace
+
+// One aggregation entry per distinct (site, message) key.  The key and
+// representative are immutable once published; pending is the lock-free
+// duplicate counter and deadline the end of the current window.
+struct dedup_entry {
+  std::uint64_t key = 0;
+  error representative;
+  std::atomic<std::uint64_t> pending{0};
+  std::atomic<std::int64_t> deadline{0};
+};
+
+struct dedup_reporter::shard {
+  std::atomic<dedup_entry *> slots[dedup_slots] = {};
+  std::mutex write_mutex;
+  std::atomic<std::uint64_t> suppressed{0};
+};
+
+dedup_reporter::dedup_reporter(report_sink &sink,
+                               std::chrono::milliseconds window)
+    : sink_(sink), window_(window), shards_(new shard[dedup_shards]) {}
+
+dedup_reporter::~dedup_reporter() {
+  flush();
+  for (std::size_t s = 0; s < dedup_shards; ++s) {
+    for (std::size_t i = 0; i < dedup_slots; ++i) {
+      delete shards_[s].slots[i].load(std::memory_order_relaxed);
+    }
+  }
+  delete[] shards_;
+}
+
+dedup_reporter::shard *dedup_reporter::shard_of(
+    std::uint64_t hash) const noexcept {
+  return &shards_[hash % dedup_shards];
+}
+
+void dedup_reporter::report(error err) {
+  const detail::node *n = detail::access::get(err);
+  if (n == nullptr && detail::access::get_static(err) == nullptr) {
+    return; // empty error
+  }
+  std::uint64_t key;
+  if (n != nullptr) {
+    key = key_of(n);
+  } else {
+    // Sentinels are identified by address; no trace to key on.
+    key = reinterpret_cast<std::uint64_t>(detail::access::get_static(err));
+  }
+  shard &sh = *shard_of(key);
+  std::size_t idx = (key >> 4) & (dedup_slots - 1);
+
+  // Lock-free duplicate path.
+  for (std::size_t i = 0; i < dedup_slots; ++i) {
+    dedup_entry *e =
+        sh.slots[(idx + i) & (dedup_slots - 1)].load(std::memory_order_acquire);
+    if (e == nullptr) {
+      break; // new key
+    }
+    if (e->key != key) {
+      continue;
+    }
+    e->pending.fetch_add(1, std::memory_order_relaxed);
+    sh.suppressed.fetch_add(1, std::memory_order_relaxed);
+    std::int64_t now = now_ns();
+    if (now < e->deadline.load(std::memory_order_relaxed)) {
+      return; // inside the window: counted, dropped
+    }
+    // Window expired; one thread wins the emission.
+    std::lock_guard<std::mutex> lock(sh.write_mutex);
+    if (now < e->deadline.load(std::memory_order_relaxed)) {
+      return; // lost the race, the winner already opened a new window
+    }
+    std::uint64_t count = e->pending.exchange(0, std::memory_order_relaxed);
+    e->deadline.store(now + window_.count(), std::memory_order_relaxed);
+    if (count > 0) {
+      sink_.on_report(e->representative, count);
+    }
+    return;
+  }
+
+  // First occurrence of this key: publish an entry, emit immediately.
+  std::lock_guard<std::mutex> lock(sh.write_mutex);
+  for (std::size_t i = 0; i < dedup_slots; ++i) {
+    std::atomic<dedup_entry *> &slot = sh.slots[(idx + i) & (dedup_slots - 1)];
+    dedup_entry *e = slot.load(std::memory_order_relaxed);
+    if (e == nullptr) {
+      auto *fresh = new dedup_entry;
+      fresh->key = key;
+      fresh->representative = std::move(err);
+      fresh->deadline.store(now_ns() + window_.count(),
+                            std::memory_order_relaxed);
+      slot.store(fresh, std::memory_order_release);
+      sink_.on_report(fresh->representative, 1);
+      return;
+    }
+    if (e->key == key) {
+      // Raced with another thread inserting the same key.
+      e->pending.fetch_add(1, std::memory_order_relaxed);
+      sh.suppressed.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+  }
+  // Shard full: degrade to pass-through rather than dropping.
+  sink_.on_report(err, 1);
+}
+
+void dedup_reporter::flush() {
+  std::int64_t now = now_ns();
+  for (std::size_t s = 0; s < dedup_shards; ++s) {
+    shard &sh = shards_[s];
+    std::lock_guard<std::mutex> lock(sh.write_mutex);
+    for (std::size_t i = 0; i < dedup_slots; ++i) {
+      dedup_entry *e = sh.slots[i].load(std::memory_order_relaxed);
+      if (e == nullptr) {
+        continue;
+      }
+      std::uint64_t count = e->pending.exchange(0, std::memory_order_relaxed);
+      e->deadline.store(now + window_.count(), std::memory_order_relaxed);
+      if (count > 0) {
+        sink_.on_report(e->representative, count);
+      }
+    }
+  }
+}
+
+std::uint64_t dedup_reporter::suppressed() const noexcept {
+  std::uint64_t total = 0;
+  for (std::size_t s = 0; s < dedup_shards; ++s) {
+    total += shards_[s].suppressed.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+} // namespace errors
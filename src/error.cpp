@@ -0,0 +1,581 @@
+#include "errors/errors.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "errors/arena.hpp"
+#include "errors/format.hpp"
+#include "errors/observe.hpp"
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+std::atomic<capture_policy> g_capture_policy{capture_policy::lazy};
+std::atomic<std::uint32_t> g_sample_rate{16};
+
+// Per-thread, per-call-site sampling counters for capture_policy::sampled.
+// Open addressing keyed by the new_error()/wrap() return address; no
+// atomics, no locks.  A full table falls back to a shared per-thread
+// counter, which still bounds capture cost.
+struct sample_table {
+  static constexpr std::size_t slots = 256; // power of two
+
+  const void *sites[slots] = {};
+  std::uint32_t counters[slots] = {};
+  std::uint32_t overflow_counter = 0;
+
+  bool should_capture(const void *site, std::uint32_t rate) noexcept {
+    std::size_t idx =
+        (reinterpret_cast<std::uintptr_t>(site) >> 4) & (slots - 1);
+    for (std::size_t i = 0; i < 8; ++i) {
+      std::size_t probe = (idx + i) & (slots - 1);
+      if (sites[probe] == site) {
+        return counters[probe]++ % rate == 0;
+      }
+      if (sites[probe] == nullptr) {
+        sites[probe] = site;
+        counters[probe] = 1;
+        return true; // first error from this site always captures
+      }
+    }
+    return overflow_counter++ % rate == 0;
+  }
+};
+
+thread_local sample_table t_samples;
+
+// Memory governor.  Every node allocation/release adjusts a thread-local
+// delta; deltas reconcile with the global live counter once they exceed
+// a batch, so the common path never touches the shared cache line.
+// Degradation thresholds are precomputed on set_memory_budget().
+std::atomic<std::size_t> g_budget{0};
+std::atomic<std::size_t> g_budget_soft{0}; // ~75%: drop traces
+std::atomic<std::size_t> g_budget_hard{0}; // ~90%: also truncate messages
+std::atomic<std::int64_t> g_live_bytes{0};
+
+constexpr std::int64_t account_batch = 16 * 1024;
+
+struct budget_state {
+  std::int64_t pending = 0;
+
+  ~budget_state() {
+    if (pending != 0) {
+      g_live_bytes.fetch_add(pending, std::memory_order_relaxed);
+    }
+  }
+};
+
+thread_local budget_state t_budget;
+
+void account(std::int64_t delta) noexcept {
+  t_budget.pending += delta;
+  if (t_budget.pending >= account_batch || t_budget.pending <= -account_batch)
+      [[unlikely]] {
+    g_live_bytes.fetch_add(t_budget.pending, std::memory_order_relaxed);
+    t_budget.pending = 0;
+  }
+}
+
+enum class mem_pressure : std::uint8_t { none, drop_traces, truncate };
+
+mem_pressure current_pressure() noexcept {
+  std::size_t hard = g_budget_hard.load(std::memory_order_relaxed);
+  if (hard == 0) [[likely]] {
+    return mem_pressure::none;
+  }
+  std::int64_t live = g_live_bytes.load(std::memory_order_relaxed);
+  if (live < 0 ||
+      static_cast<std::size_t>(live) <
+          g_budget_soft.load(std::memory_order_relaxed)) {
+    return mem_pressure::none;
+  }
+  return static_cast<std::size_t>(live) >= hard ? mem_pressure::truncate
+                                                : mem_pressure::drop_traces;
+}
+
+bool should_capture_trace(const void *site) noexcept {
+  switch (g_capture_policy.load(std::memory_order_relaxed)) {
+  case capture_policy::sampled: {
+    std::uint32_t rate = g_sample_rate.load(std::memory_order_relaxed);
+    if (rate <= 1) {
+      return true;
+    }
+    return t_samples.should_capture(site, rate);
+  }
+  case capture_policy::lazy:
+  case capture_policy::eager:
+  case capture_policy::origin_only: // short-circuited in finish_node()
+    break;
+  }
+  return true;
+}
+
+detail::node *alloc_node(detail::node *cause, arena *a) {
+  detail::node *n;
+  if (a != nullptr) {
+    n = new (a->allocate(sizeof(detail::node), alignof(detail::node)))
+        detail::node;
+    n->origin = detail::node_origin::arena;
+    n->owner = a;
+    a->add_finalizer(
+        [](void *obj) noexcept { static_cast<detail::node *>(obj)->~node(); },
+        n);
+  } else if (void *slot = detail::pool_try_pop(); slot != nullptr) {
+    n = new (slot) detail::node;
+    n->origin = detail::node_origin::pool;
+  } else {
+    n = new detail::node;
+  }
+  account(static_cast<std::int64_t>(sizeof(detail::node)));
+  n->cause = cause;
+  if (cause != nullptr) {
+    n->categories = cause->categories;
+  }
+  return n;
+}
+
+void finish_node(detail::node *n, const void *site,
+                 bool force_trace = false) {
+  detail::flight_note(site, n->categories, n->message.intern_id());
+  if (!force_trace) {
+    if (g_capture_policy.load(std::memory_order_relaxed) ==
+        capture_policy::origin_only) {
+      return; // the compile-time origin is all this error carries
+    }
+    if (current_pressure() != mem_pressure::none) {
+      return; // over budget: traces are the first thing to go
+    }
+    if (!should_capture_trace(site)) {
+      return; // sampled out: trace-less error
+    }
+  }
+  n->trace.count = detail::capture_trace(n->trace.ips, detail::max_frames);
+  if (g_capture_policy.load(std::memory_order_relaxed) ==
+      capture_policy::eager) {
+    detail::ensure_symbolized(*n);
+  }
+}
+
+detail::node *make_node(const void *site, detail::node *cause,
+                        std::string message,
+                        const std::source_location &origin,
+                        arena *a = nullptr, bool force_trace = false) {
+  detail::node *n = alloc_node(cause, a);
+  n->created_at = origin;
+  if (detail::interning_enabled()) {
+    if (std::uint32_t id = detail::intern_message(message); id != 0) {
+      n->message.assign_interned(id);
+      finish_node(n, site, force_trace);
+      return n;
+    }
+  }
+  if (message.size() > detail::msg_storage::inline_capacity &&
+      current_pressure() == mem_pressure::truncate) {
+    // Hard pressure: keep the head of the message in the in-node buffer
+    // rather than growing the heap.
+    message.resize(detail::msg_storage::inline_capacity);
+  }
+  n->message.assign(std::move(message));
+  account(static_cast<std::int64_t>(n->message.heap_bytes()));
+  finish_node(n, site, force_trace);
+  return n;
+}
+
+detail::node *make_node(const void *site, detail::node *cause,
+                        static_string message,
+                        const std::source_location &origin) {
+  detail::node *n = alloc_node(cause, nullptr);
+  n->created_at = origin;
+  n->message.assign_view(message);
+  finish_node(n, site);
+  return n;
+}
+
+// Arena variant: message bytes that do not fit the inline buffer are
+// copied into the arena, keeping the whole chain off the general heap.
+detail::node *make_node(const void *site, detail::node *cause,
+                        std::string_view message,
+                        const std::source_location &origin, arena &a) {
+  detail::node *n = alloc_node(cause, &a);
+  n->created_at = origin;
+  if (message.size() <= detail::msg_storage::inline_capacity) {
+    n->message.assign_copy(message);
+  } else {
+    char *copy = static_cast<char *>(a.allocate(message.size(), 1));
+    std::memcpy(copy, message.data(), message.size());
+    n->message.assign_view({copy, message.size()});
+  }
+  finish_node(n, site);
+  return n;
+}
+
+// Copying variant for bytes rendered into a caller-owned buffer
+// (wrap_fmt): inline-sized messages land in the in-node buffer without
+// ever touching the heap.
+detail::node *make_node_copy(const void *site, detail::node *cause,
+                             std::string_view message,
+                             const std::source_location &origin) {
+  detail::node *n = alloc_node(cause, nullptr);
+  n->created_at = origin;
+  if (detail::interning_enabled()) {
+    if (std::uint32_t id = detail::intern_message(message); id != 0) {
+      n->message.assign_interned(id);
+      finish_node(n, site);
+      return n;
+    }
+  }
+  if (message.size() > detail::msg_storage::inline_capacity &&
+      current_pressure() == mem_pressure::truncate) {
+    message = message.substr(0, detail::msg_storage::inline_capacity);
+  }
+  n->message.assign_copy(message);
+  account(static_cast<std::int64_t>(n->message.heap_bytes()));
+  finish_node(n, site);
+  return n;
+}
+
+} // namespace
+
+void set_capture_policy(capture_policy policy) noexcept {
+  g_capture_policy.store(policy, std::memory_order_relaxed);
+}
+
+capture_policy get_capture_policy() noexcept {
+  return g_capture_policy.load(std::memory_order_relaxed);
+}
+
+void set_trace_sample_rate(std::uint32_t rate) noexcept {
+  g_sample_rate.store(rate, std::memory_order_relaxed);
+}
+
+std::uint32_t get_trace_sample_rate() noexcept {
+  return g_sample_rate.load(std::memory_order_relaxed);
+}
+
+void set_memory_budget(std::size_t bytes) noexcept {
+  g_budget.store(bytes, std::memory_order_relaxed);
+  g_budget_soft.store(bytes - bytes / 4, std::memory_order_relaxed);
+  g_budget_hard.store(bytes - bytes / 10, std::memory_order_relaxed);
+}
+
+std::size_t get_memory_budget() noexcept {
+  return g_budget.load(std::memory_order_relaxed);
+}
+
+std::size_t approximate_memory_use() noexcept {
+  std::int64_t live = g_live_bytes.load(std::memory_order_relaxed);
+  return live > 0 ? static_cast<std::size_t>(live) : 0;
+}
+
+void flush_memory_accounting() noexcept {
+  if (t_budget.pending != 0) {
+    g_live_bytes.fetch_add(t_budget.pending, std::memory_order_relaxed);
+    t_budget.pending = 0;
+  }
+}
+
+namespace detail {
+
+void destroy(node *n) noexcept {
+  while (n != nullptr) {
+    // Release-acquire so the destructing thread sees every write made by
+    // threads that held (and dropped) earlier references.
+    if (n->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return; // still referenced elsewhere
+    }
+    account(-static_cast<std::int64_t>(sizeof(node) +
+                                       n->message.heap_bytes()));
+    node *next = n->cause;
+    switch (n->origin) {
+    case node_origin::heap:
+      delete n;
+      break;
+    case node_origin::pool:
+      n->~node();
+      pool_push(n);
+      break;
+    case node_origin::arena:
+      // Finalized and freed by the owning arena.
+      break;
+    }
+    n = next;
+  }
+}
+
+void ensure_symbolized(const node &n) {
+  if (n.symbolized.load(std::memory_order_acquire)) {
+    return;
+  }
+  n.lock_lazy();
+  if (!n.symbolized.load(std::memory_order_relaxed)) {
+    n.resolved = symbolize_trace(n.trace.ips, n.trace.count);
+    n.symbolized.store(true, std::memory_order_release);
+  }
+  n.unlock_lazy();
+}
+
+} // namespace detail
+
+const char *error::what() const noexcept {
+  if (const static_error *s = static_ptr()) {
+    return s->c_message();
+  }
+  const detail::node *n = node_ptr();
+  if (n == nullptr) {
+    return "";
+  }
+  if (!n->rendered_ready.load(std::memory_order_acquire)) {
+    std::string out;
+    format_append(*this, out);
+    n->lock_lazy();
+    if (!n->rendered_ready.load(std::memory_order_relaxed)) {
+      n->rendered = std::move(out);
+      n->rendered_ready.store(true, std::memory_order_release);
+    }
+    n->unlock_lazy();
+  }
+  return n->rendered.c_str();
+}
+
+std::string_view error::message() const noexcept {
+  if (const static_error *s = static_ptr()) {
+    return s->message();
+  }
+  const detail::node *n = node_ptr();
+  return n != nullptr ? n->message.get() : std::string_view();
+}
+
+error error::share() const noexcept {
+  if (detail::node *n = node_ptr(); n != nullptr) {
+    n->retain();
+    return error(n);
+  }
+  if (const static_error *s = static_ptr()) {
+    return error(*s);
+  }
+  return error();
+}
+
+error error::cause() const noexcept {
+  const detail::node *n = node_ptr();
+  if (n == nullptr) {
+    return error();
+  }
+  if (n->cause != nullptr) {
+    n->cause->retain();
+    return error(n->cause);
+  }
+  if (n->sentinel_cause != nullptr) {
+    return error(*n->sentinel_cause);
+  }
+  return error();
+}
+
+std::source_location error::origin() const noexcept {
+  const detail::node *n = node_ptr();
+  return n != nullptr ? n->created_at : std::source_location();
+}
+
+std::span<const frame> error::trace() const {
+  const detail::node *n = node_ptr();
+  if (n == nullptr) {
+    return {};
+  }
+  detail::ensure_symbolized(*n);
+  return n->resolved;
+}
+
+error new_error(std::string message, std::source_location origin) {
+  detail::note_create();
+  return detail::access::make(make_node(__builtin_return_address(0), nullptr,
+                                        std::move(message), origin));
+}
+
+error new_error(static_string message, std::source_location origin) {
+  detail::note_create();
+  return detail::access::make(
+      make_node(__builtin_return_address(0), nullptr, message, origin));
+}
+
+error with_trace(std::string message, std::source_location origin) {
+  detail::note_create();
+  return detail::access::make(
+      make_node(__builtin_return_address(0), nullptr, std::move(message),
+                origin, nullptr, /*force_trace=*/true));
+}
+
+error wrap(error err, std::string message, std::source_location origin) {
+  detail::note_wrap();
+  const static_error *sentinel = detail::access::get_static(err);
+  detail::node *n = make_node(__builtin_return_address(0),
+                              detail::access::release(err),
+                              std::move(message), origin);
+  n->sentinel_cause = sentinel;
+  if (sentinel != nullptr) {
+    n->categories |= static_cast<std::uint64_t>(sentinel->categories());
+  }
+  return detail::access::make(n);
+}
+
+error wrap(error err, static_string message, std::source_location origin) {
+  detail::note_wrap();
+  const static_error *sentinel = detail::access::get_static(err);
+  detail::node *n = make_node(__builtin_return_address(0),
+                              detail::access::release(err), message, origin);
+  n->sentinel_cause = sentinel;
+  if (sentinel != nullptr) {
+    n->categories |= static_cast<std::uint64_t>(sentinel->categories());
+  }
+  return detail::access::make(n);
+}
+
+error new_error(arena &a, std::string_view message,
+                std::source_location origin) {
+  detail::note_create();
+  return detail::access::make(
+      make_node(__builtin_return_address(0), nullptr, message, origin, a));
+}
+
+error wrap(arena &a, error err, std::string_view message,
+           std::source_location origin) {
+  detail::note_wrap();
+  const static_error *sentinel = detail::access::get_static(err);
+  detail::node *n = make_node(__builtin_return_address(0),
+                              detail::access::release(err), message, origin,
+                              a);
+  n->sentinel_cause = sentinel;
+  if (sentinel != nullptr) {
+    n->categories |= static_cast<std::uint64_t>(sentinel->categories());
+  }
+  return detail::access::make(n);
+}
+
+namespace detail {
+
+node *alloc_wire_node() { return alloc_node(nullptr, nullptr); }
+
+// wrap_fmt back ends: the message arrives fully rendered in a
+// caller-owned buffer, so it is copied straight into node storage.
+
+error wrap_rendered(error err, std::string_view message,
+                    std::source_location origin) {
+  detail::note_wrap();
+  const static_error *sentinel = detail::access::get_static(err);
+  detail::node *n = make_node_copy(__builtin_return_address(0),
+                                   detail::access::release(err), message,
+                                   origin);
+  n->sentinel_cause = sentinel;
+  if (sentinel != nullptr) {
+    n->categories |= static_cast<std::uint64_t>(sentinel->categories());
+  }
+  return detail::access::make(n);
+}
+
+error wrap_rendered(arena &a, error err, std::string_view message,
+                    std::source_location origin) {
+  detail::note_wrap();
+  const static_error *sentinel = detail::access::get_static(err);
+  detail::node *n = make_node(__builtin_return_address(0),
+                              detail::access::release(err), message, origin,
+                              a);
+  n->sentinel_cause = sentinel;
+  if (sentinel != nullptr) {
+    n->categories |= static_cast<std::uint64_t>(sentinel->categories());
+  }
+  return detail::access::make(n);
+}
+
+} // namespace detail
+
+error from_raw_capture(std::span<void *const> frames, std::string message) {
+  detail::note_create();
+  detail::node *n = alloc_node(nullptr, nullptr);
+  n->message.assign(std::move(message));
+  account(static_cast<std::int64_t>(n->message.heap_bytes()));
+  std::size_t count =
+      frames.size() < detail::max_frames ? frames.size() : detail::max_frames;
+  if (count > 0) {
+    std::memcpy(n->trace.ips, frames.data(), count * sizeof(void *));
+  }
+  n->trace.count = count;
+  if (g_capture_policy.load(std::memory_order_relaxed) ==
+      capture_policy::eager) {
+    detail::ensure_symbolized(*n);
+  }
+  return detail::access::make(n);
+}
+
+error with_category(error err, category c) {
+  if (detail::node *n = detail::access::get(err); n != nullptr) {
+    if (n->shared()) {
+      // Copy-on-write: other holders must not see the new bits.  Wrap
+      // with an empty message to get a private head (rendering skips
+      // empty messages).
+      err = wrap(std::move(err), static_string(), std::source_location());
+      n = detail::access::get(err);
+    }
+    n->categories |= static_cast<std::uint64_t>(c);
+    return err;
+  }
+  if (const static_error *s = detail::access::get_static(err)) {
+    // Sentinels are immutable; materialize a message-less tagging node
+    // around the sentinel (rendering skips empty messages).
+    detail::node *n = make_node(__builtin_return_address(0), nullptr,
+                                static_string(), std::source_location());
+    n->sentinel_cause = s;
+    n->categories = static_cast<std::uint64_t>(s->categories()) |
+                    static_cast<std::uint64_t>(c);
+    return detail::access::make(n);
+  }
+  return err;
+}
+
+category categories(const error &err) noexcept {
+  if (const detail::node *n = detail::access::get(err)) {
+    return category{n->categories};
+  }
+  if (const static_error *s = detail::access::get_static(err)) {
+    return s->categories();
+  }
+  return category::none;
+}
+
+bool has_category(const error &err, category mask) noexcept {
+  return any(categories(err) & mask);
+}
+
+bool is(const error &err, const error &target) noexcept {
+  if (const static_error *s = detail::access::get_static(target)) {
+    return is(err, *s);
+  }
+  const detail::node *t = detail::access::get(target);
+  if (t == nullptr) {
+    return !err;
+  }
+  for (const detail::node *n = detail::access::get(err); n != nullptr;
+       n = n->cause) {
+    if (n == t) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool is(const error &err, const static_error &target) noexcept {
+  if (detail::access::get_static(err) == &target) {
+    return true;
+  }
+  for (const detail::node *n = detail::access::get(err); n != nullptr;
+       n = n->cause) {
+    if (n->sentinel_cause == &target) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace errors
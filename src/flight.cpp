@@ -0,0 +1,176 @@
+#include "errors/flight.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+// Each slot is a seqlock: the owning thread bumps seq to odd, fences,
+// writes the fields, then publishes with an even release store.  The
+// release fence after the odd store is what keeps the protocol sound on
+// weakly-ordered hardware — without it a field store could become
+// visible before the odd marker and a reader could accept a mixed
+// record.  A snapshot reader that observes a changed or odd seq skips
+// the slot instead of returning it torn.
+struct flight_slot {
+  std::atomic<std::uint64_t> seq{0};
+  std::atomic<std::uint64_t> timestamp{0};
+  std::atomic<std::uint64_t> site{0};
+  std::atomic<std::uint64_t> categories{0};
+  std::atomic<std::uint64_t> intern_id{0};
+};
+
+struct flight_ring {
+  explicit flight_ring(std::size_t capacity, std::uint32_t thread_no)
+      : slots(capacity), mask(capacity - 1), thread(thread_no) {}
+
+  std::vector<flight_slot> slots;
+  std::size_t mask;
+  // Written only by the owning thread; read by snapshots.
+  std::atomic<std::uint64_t> head{0};
+  std::uint32_t thread;
+};
+
+std::atomic<bool> g_flight_enabled{false};
+std::atomic<std::size_t> g_flight_capacity{256};
+std::atomic<std::uint32_t> g_next_thread{1};
+
+std::mutex g_flight_mutex;                // guards the two vectors below
+std::vector<flight_ring *> g_rings;       // live per-thread rings
+std::vector<flight_record> g_retired;     // records of exited threads
+constexpr std::size_t max_retired = 4096; // oldest dropped beyond this
+
+// Reads every stable record of a ring, oldest first.
+void read_ring(const flight_ring &ring, std::vector<flight_record> &out) {
+  std::uint64_t head = ring.head.load(std::memory_order_acquire);
+  std::size_t capacity = ring.mask + 1;
+  std::uint64_t first = head > capacity ? head - capacity : 0;
+  for (std::uint64_t i = first; i < head; ++i) {
+    const flight_slot &s = ring.slots[i & ring.mask];
+    std::uint64_t seq_before = s.seq.load(std::memory_order_acquire);
+    flight_record r;
+    r.timestamp_ns = s.timestamp.load(std::memory_order_relaxed);
+    r.site = reinterpret_cast<const void *>(
+        static_cast<std::uintptr_t>(s.site.load(std::memory_order_relaxed)));
+    r.categories = s.categories.load(std::memory_order_relaxed);
+    r.intern_id = static_cast<std::uint32_t>(
+        s.intern_id.load(std::memory_order_relaxed));
+    r.thread = ring.thread;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    std::uint64_t seq_after = s.seq.load(std::memory_order_relaxed);
+    if (seq_before != seq_after || (seq_before & 1) != 0) {
+      continue; // overwritten mid-read
+    }
+    out.push_back(r);
+  }
+}
+
+// Thread-local handle: registers the ring on first record, and on
+// thread exit moves its surviving records to the retired store so an
+// incident snapshot still sees errors from threads that have gone.
+struct ring_handle {
+  flight_ring *ring = nullptr;
+
+  ~ring_handle() {
+    if (ring == nullptr) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(g_flight_mutex);
+    std::erase(g_rings, ring);
+    read_ring(*ring, g_retired);
+    if (g_retired.size() > max_retired) {
+      g_retired.erase(g_retired.begin(),
+                      g_retired.end() - max_retired);
+    }
+    delete ring;
+  }
+};
+
+thread_local ring_handle t_ring;
+
+flight_ring *local_ring() {
+  if (t_ring.ring != nullptr) {
+    return t_ring.ring;
+  }
+  std::size_t capacity = 1;
+  while (capacity < g_flight_capacity.load(std::memory_order_relaxed)) {
+    capacity *= 2;
+  }
+  auto *ring = new flight_ring(
+      capacity, g_next_thread.fetch_add(1, std::memory_order_relaxed));
+  {
+    std::lock_guard<std::mutex> lock(g_flight_mutex);
+    g_rings.push_back(ring);
+  }
+  t_ring.ring = ring;
+  return ring;
+}
+
+std::uint64_t now_ns() noexcept {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+} // namespace
+
+namespace detail {
+
+void flight_note(const void *site, std::uint64_t categories,
+                 std::uint32_t intern_id) {
+  if (!g_flight_enabled.load(std::memory_order_relaxed)) {
+    return;
+  }
+  flight_ring *ring = local_ring();
+  std::uint64_t head = ring->head.load(std::memory_order_relaxed);
+  flight_slot &s = ring->slots[head & ring->mask];
+  std::uint64_t seq = s.seq.load(std::memory_order_relaxed);
+  s.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  s.timestamp.store(now_ns(), std::memory_order_relaxed);
+  s.site.store(reinterpret_cast<std::uintptr_t>(site),
+               std::memory_order_relaxed);
+  s.categories.store(categories, std::memory_order_relaxed);
+  s.intern_id.store(intern_id, std::memory_order_relaxed);
+  s.seq.store(seq + 2, std::memory_order_release);
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace detail
+
+void enable_flight_recorder(std::size_t ring_capacity) {
+  if (ring_capacity > 0) {
+    g_flight_capacity.store(ring_capacity, std::memory_order_relaxed);
+  }
+  g_flight_enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable_flight_recorder() {
+  g_flight_enabled.store(false, std::memory_order_relaxed);
+}
+
+std::vector<flight_record> flight_snapshot() {
+  std::vector<flight_record> out;
+  {
+    std::lock_guard<std::mutex> lock(g_flight_mutex);
+    out = g_retired;
+    for (const flight_ring *ring : g_rings) {
+      read_ring(*ring, out);
+    }
+  }
+  std::sort(out.begin(), out.end(),
+            [](const flight_record &a, const flight_record &b) {
+              return a.timestamp_ns < b.timestamp_ns;
+            });
+  return out;
+}
+
+} // namespace errors
@@ -0,0 +1,32 @@
+#include "errors/fmt.hpp"
+
+namespace errors {
+namespace detail {
+
+void vformat(fmt_sink &sink, const char *fmt, std::span<const fmt_arg> args) {
+  std::size_t next = 0;
+  const char *run = fmt;
+  const char *p = fmt;
+  while (*p != '\0') {
+    if (*p != '{' && *p != '}') {
+      ++p;
+      continue;
+    }
+    sink.append({run, static_cast<std::size_t>(p - run)});
+    if (p[0] == '{' && p[1] == '}') {
+      // The consteval parse guarantees next < args.size().
+      args[next].render(sink, args[next].value);
+      ++next;
+      p += 2;
+    } else {
+      // "{{" or "}}": emit the brace once.
+      sink.push(*p);
+      p += 2;
+    }
+    run = p;
+  }
+  sink.append({run, static_cast<std::size_t>(p - run)});
+}
+
+} // namespace detail
+} // namespace errors
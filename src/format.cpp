@@ -0,0 +1,92 @@
+#include "errors/format.hpp"
+
+#include <cstring>
+
+#include "errors/observe.hpp"
+#include "node.hpp"
+
+namespace errors {
+
+namespace detail {
+
+void render_pieces(const error &err,
+                   void (*emit)(void *ctx, std::string_view piece),
+                   void *ctx) {
+  bool first = true;
+  auto piece = [&](std::string_view message) {
+    if (message.empty()) {
+      return; // e.g. a pure category-tagging node
+    }
+    if (!first) {
+      emit(ctx, ": ");
+    }
+    emit(ctx, message);
+    first = false;
+  };
+
+  if (const static_error *s = access::get_static(err)) {
+    piece(s->message());
+    return;
+  }
+  const node *link = access::get(err);
+  if (link == nullptr) {
+    return;
+  }
+  for (;; link = link->cause) {
+    piece(link->message.get());
+    if (link->cause == nullptr) {
+      break;
+    }
+  }
+  if (link->sentinel_cause != nullptr) {
+    piece(link->sentinel_cause->message());
+  }
+}
+
+} // namespace detail
+
+std::size_t rendered_size(const error &err) noexcept {
+  std::size_t total = 0;
+  detail::render_pieces(
+      err,
+      [](void *ctx, std::string_view piece) {
+        *static_cast<std::size_t *>(ctx) += piece.size();
+      },
+      &total);
+  return total;
+}
+
+std::size_t format_to(const error &err, std::span<char> buffer) noexcept {
+  detail::note_render();
+  struct sink_state {
+    char *out;
+    std::size_t remaining;
+    std::size_t written;
+  } state{buffer.data(), buffer.size(), 0};
+  detail::render_pieces(
+      err,
+      [](void *ctx, std::string_view piece) {
+        auto &s = *static_cast<sink_state *>(ctx);
+        std::size_t n = piece.size() < s.remaining ? piece.size()
+                                                   : s.remaining;
+        std::memcpy(s.out, piece.data(), n);
+        s.out += n;
+        s.remaining -= n;
+        s.written += n;
+      },
+      &state);
+  return state.written;
+}
+
+void format_append(const error &err, std::string &out) {
+  detail::note_render();
+  out.reserve(out.size() + rendered_size(err));
+  detail::render_pieces(
+      err,
+      [](void *ctx, std::string_view piece) {
+        static_cast<std::string *>(ctx)->append(piece);
+      },
+      &out);
+}
+
+} // namespace errors
@@ -0,0 +1,324 @@
+#include "errors/freeze.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+// On-buffer layout.  Every record is 8-byte aligned: the level table
+// follows the header, fixed-size context and trace arrays follow the
+// levels, and the string blob sits at the end.  All references are
+// offsets from the buffer start, so the whole thing is
+// position-independent.
+struct fz_header {
+  std::uint32_t magic; // 'F' 'Z' 'E' '1'
+  std::uint32_t total_size;
+  std::uint32_t levels;
+  std::uint32_t reserved;
+};
+
+struct fz_level {
+  std::uint64_t categories;
+  std::uint32_t msg_off;
+  std::uint32_t msg_len;
+  std::uint32_t trace_off;
+  std::uint32_t trace_count;
+  std::uint32_t ctx_off;
+  std::uint32_t ctx_count;
+};
+
+struct fz_ctx {
+  std::uint32_t key_off;
+  std::uint32_t key_len;
+  std::uint32_t kind; // context_value::kind
+  std::uint32_t str_len;
+  std::uint64_t value; // i64 / bool / string offset
+};
+
+constexpr std::uint32_t fz_magic = 0x31455A46; // "FZE1" little-endian
+
+const fz_header *header_of(const std::byte *buf) noexcept {
+  return reinterpret_cast<const fz_header *>(buf);
+}
+
+const fz_level *level_of(const std::byte *buf, std::size_t i) noexcept {
+  return reinterpret_cast<const fz_level *>(buf + sizeof(fz_header)) + i;
+}
+
+bool in_bounds(std::uint64_t off, std::uint64_t len,
+               std::uint64_t total) noexcept {
+  return off <= total && len <= total - off;
+}
+
+// Full structural validation of an untrusted buffer: every offset+length
+// a accessor would follow must land inside the buffer, and the fixed
+// trace/context arrays must keep their 8-byte alignment.  freeze()
+// output always passes; from_bytes() input comes from retry logs and
+// gets no benefit of the doubt.
+bool validate(const std::byte *buf, std::size_t size) noexcept {
+  const fz_header *h = header_of(buf);
+  for (std::size_t i = 0; i < h->levels; ++i) {
+    const fz_level *l = level_of(buf, i);
+    if (!in_bounds(l->msg_off, l->msg_len, size)) {
+      return false;
+    }
+    if ((l->trace_off & 7) != 0 ||
+        !in_bounds(l->trace_off,
+                   std::uint64_t{l->trace_count} * sizeof(std::uint64_t),
+                   size)) {
+      return false;
+    }
+    if ((l->ctx_off & 7) != 0 ||
+        !in_bounds(l->ctx_off, std::uint64_t{l->ctx_count} * sizeof(fz_ctx),
+                   size)) {
+      return false;
+    }
+    for (std::size_t c = 0; c < l->ctx_count; ++c) {
+      const auto *ctx = reinterpret_cast<const fz_ctx *>(buf + l->ctx_off) + c;
+      if (!in_bounds(ctx->key_off, ctx->key_len, size)) {
+        return false;
+      }
+      switch (static_cast<context_value::kind>(ctx->kind)) {
+      case context_value::kind::i64:
+      case context_value::kind::boolean:
+        break;
+      case context_value::kind::str:
+        if (!in_bounds(ctx->value, ctx->str_len, size)) {
+          return false;
+        }
+        break;
+      default:
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+std::size_t frozen_error::depth() const noexcept {
+  return buffer_ != nullptr ? header_of(buffer_.get())->levels : 0;
+}
+
+std::string_view frozen_error::message(std::size_t level) const noexcept {
+  if (level >= depth()) {
+    return {};
+  }
+  const fz_level *l = level_of(buffer_.get(), level);
+  return {reinterpret_cast<const char *>(buffer_.get()) + l->msg_off,
+          l->msg_len};
+}
+
+category frozen_error::categories() const noexcept {
+  if (depth() == 0) {
+    return category::none;
+  }
+  return category{level_of(buffer_.get(), 0)->categories};
+}
+
+std::span<const std::uint64_t> frozen_error::trace(
+    std::size_t level) const noexcept {
+  if (level >= depth()) {
+    return {};
+  }
+  const fz_level *l = level_of(buffer_.get(), level);
+  return {reinterpret_cast<const std::uint64_t *>(buffer_.get() +
+                                                  l->trace_off),
+          l->trace_count};
+}
+
+std::size_t frozen_error::context_count(std::size_t level) const noexcept {
+  return level < depth() ? level_of(buffer_.get(), level)->ctx_count : 0;
+}
+
+context_pair frozen_error::context(std::size_t level,
+                                   std::size_t i) const noexcept {
+  const fz_level *l = level_of(buffer_.get(), level);
+  const auto *c =
+      reinterpret_cast<const fz_ctx *>(buffer_.get() + l->ctx_off) + i;
+  const char *base = reinterpret_cast<const char *>(buffer_.get());
+  std::string_view key{base + c->key_off, c->key_len};
+  switch (static_cast<context_value::kind>(c->kind)) {
+  case context_value::kind::str:
+    return {key, std::string_view{base + c->value, c->str_len}};
+  case context_value::kind::boolean:
+    return {key, c->value != 0};
+  case context_value::kind::i64:
+    break;
+  }
+  return {key, static_cast<std::int64_t>(c->value)};
+}
+
+std::string frozen_error::to_string() const {
+  std::string out;
+  for (std::size_t i = 0; i < depth(); ++i) {
+    std::string_view msg = message(i);
+    if (msg.empty()) {
+      continue;
+    }
+    if (!out.empty()) {
+      out += ": ";
+    }
+    out.append(msg);
+  }
+  return out;
+}
+
+std::span<const std::byte> frozen_error::bytes() const noexcept {
+  return {buffer_.get(), size_};
+}
+
+frozen_error frozen_error::from_bytes(std::span<const std::byte> data) {
+  frozen_error f;
+  if (data.size() < sizeof(fz_header)) {
+    return f;
+  }
+  const fz_header *h = header_of(data.data());
+  if (h->magic != fz_magic || h->total_size != data.size() ||
+      sizeof(fz_header) +
+              std::uint64_t{h->levels} * sizeof(fz_level) >
+          data.size()) {
+    return f;
+  }
+  if (!validate(data.data(), data.size())) {
+    return f;
+  }
+  f.buffer_ = std::make_unique<std::byte[]>(data.size());
+  std::memcpy(f.buffer_.get(), data.data(), data.size());
+  f.size_ = data.size();
+  return f;
+}
+
+frozen_error freeze(const error &err) {
+  frozen_error f;
+
+  // Collect the levels: every node outermost-in, then the sentinel tail.
+  struct level_src {
+    std::string_view msg;
+    std::uint64_t categories = 0;
+    const detail::raw_trace *trace = nullptr;
+    std::span<const context_pair> ctx;
+  };
+  std::vector<level_src> levels;
+  const detail::node *tail_sentinel_from = nullptr;
+  for (const detail::node *n = detail::access::get(err); n != nullptr;
+       n = n->cause) {
+    level_src l;
+    l.msg = n->message.get();
+    l.categories = n->categories;
+    l.trace = &n->trace;
+    l.ctx = n->context.pairs();
+    levels.push_back(l);
+    if (n->cause == nullptr) {
+      tail_sentinel_from = n;
+    }
+  }
+  const static_error *sentinel = detail::access::get_static(err);
+  if (tail_sentinel_from != nullptr) {
+    sentinel = tail_sentinel_from->sentinel_cause;
+  }
+  if (sentinel != nullptr) {
+    level_src l;
+    l.msg = sentinel->message();
+    l.categories = static_cast<std::uint64_t>(sentinel->categories());
+    levels.push_back(l);
+  }
+  if (levels.empty()) {
+    return f;
+  }
+
+  // Size pass: fixed records first (all 8-aligned), strings last.
+  std::size_t ctx_total = 0;
+  std::size_t trace_total = 0;
+  std::size_t strings_total = 0;
+  for (const level_src &l : levels) {
+    ctx_total += l.ctx.size();
+    trace_total += l.trace != nullptr ? l.trace->count : 0;
+    strings_total += l.msg.size();
+    for (const context_pair &p : l.ctx) {
+      strings_total += p.key.size();
+      if (p.value.type() == context_value::kind::str) {
+        strings_total += p.value.as_string().size();
+      }
+    }
+  }
+  std::size_t off_ctx = sizeof(fz_header) + levels.size() * sizeof(fz_level);
+  std::size_t off_trace = off_ctx + ctx_total * sizeof(fz_ctx);
+  std::size_t off_strings = off_trace + trace_total * sizeof(std::uint64_t);
+  std::size_t total = off_strings + strings_total;
+
+  f.buffer_ = std::make_unique<std::byte[]>(total);
+  f.size_ = total;
+  std::byte *buf = f.buffer_.get();
+
+  auto *h = reinterpret_cast<fz_header *>(buf);
+  h->magic = fz_magic;
+  h->total_size = static_cast<std::uint32_t>(total);
+  h->levels = static_cast<std::uint32_t>(levels.size());
+  h->reserved = 0;
+
+  std::size_t str_cursor = off_strings;
+  auto put_string = [&](std::string_view s) {
+    std::uint32_t off = static_cast<std::uint32_t>(str_cursor);
+    if (!s.empty()) { // empty views (CoW tagging heads) carry no data
+      std::memcpy(buf + str_cursor, s.data(), s.size());
+      str_cursor += s.size();
+    }
+    return off;
+  };
+
+  std::size_t ctx_cursor = off_ctx;
+  std::size_t trace_cursor = off_trace;
+  for (std::size_t i = 0; i < levels.size(); ++i) {
+    const level_src &src = levels[i];
+    auto *l = reinterpret_cast<fz_level *>(buf + sizeof(fz_header)) + i;
+    l->categories = src.categories;
+    l->msg_len = static_cast<std::uint32_t>(src.msg.size());
+    l->msg_off = put_string(src.msg);
+
+    l->trace_count =
+        static_cast<std::uint32_t>(src.trace != nullptr ? src.trace->count : 0);
+    l->trace_off = static_cast<std::uint32_t>(trace_cursor);
+    for (std::size_t t = 0; t < l->trace_count; ++t) {
+      std::uint64_t ip =
+          reinterpret_cast<std::uintptr_t>(src.trace->ips[t]);
+      std::memcpy(buf + trace_cursor, &ip, sizeof(ip));
+      trace_cursor += sizeof(ip);
+    }
+
+    l->ctx_count = static_cast<std::uint32_t>(src.ctx.size());
+    l->ctx_off = static_cast<std::uint32_t>(ctx_cursor);
+    for (const context_pair &p : src.ctx) {
+      auto *c = reinterpret_cast<fz_ctx *>(buf + ctx_cursor);
+      c->key_len = static_cast<std::uint32_t>(p.key.size());
+      c->key_off = put_string(p.key);
+      c->kind = static_cast<std::uint32_t>(p.value.type());
+      c->str_len = 0;
+      switch (p.value.type()) {
+      case context_value::kind::i64:
+        c->value = static_cast<std::uint64_t>(p.value.as_int64());
+        break;
+      case context_value::kind::boolean:
+        c->value = p.value.as_bool() ? 1 : 0;
+        break;
+      case context_value::kind::str: {
+        std::string_view s = p.value.as_string();
+        c->str_len = static_cast<std::uint32_t>(s.size());
+        c->value = put_string(s);
+        break;
+      }
+      }
+      ctx_cursor += sizeof(fz_ctx);
+    }
+  }
+
+  return f;
+}
+
+} // namespace errors
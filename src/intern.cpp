@@ -0,0 +1,141 @@
+#include "errors/intern.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+// Append-only string table.  Entries are immutable and never freed, so
+// readers need no synchronization beyond an acquire load; writers race
+// with CAS on the slot and the loser reuses the winner's entry.
+struct table_entry {
+  std::uint32_t id;
+  std::uint32_t size;
+  // Characters follow the header.
+  const char *data() const noexcept {
+    return reinterpret_cast<const char *>(this + 1);
+  }
+  std::string_view view() const noexcept { return {data(), size}; }
+};
+
+constexpr std::size_t table_slots = 1 << 16; // power of two
+constexpr std::uint32_t max_ids = table_slots;
+
+std::atomic<bool> g_interning{false};
+std::atomic<const table_entry *> g_slots[table_slots];
+std::atomic<const table_entry *> g_by_id[max_ids + 1];
+std::atomic<std::uint32_t> g_next_id{1};
+
+std::size_t string_hash(std::string_view s) noexcept {
+  // FNV-1a.
+  std::uint64_t h = 1469598103934665603ULL;
+  for (char c : s) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ULL;
+  }
+  return static_cast<std::size_t>(h);
+}
+
+const table_entry *make_entry(std::uint32_t id, std::string_view s) {
+  void *mem = std::malloc(sizeof(table_entry) + s.size());
+  if (mem == nullptr) {
+    return nullptr;
+  }
+  auto *e = static_cast<table_entry *>(mem);
+  e->id = id;
+  e->size = static_cast<std::uint32_t>(s.size());
+  std::memcpy(const_cast<char *>(e->data()), s.data(), s.size());
+  return e;
+}
+
+} // namespace
+
+namespace detail {
+
+std::uint32_t intern_message(std::string_view s) noexcept {
+  if (s.empty() || s.size() > UINT32_MAX) {
+    return 0;
+  }
+  std::size_t idx = string_hash(s) & (table_slots - 1);
+  const table_entry *fresh = nullptr;
+  for (std::size_t i = 0; i < table_slots; ++i) {
+    std::atomic<const table_entry *> &slot =
+        g_slots[(idx + i) & (table_slots - 1)];
+    const table_entry *e = slot.load(std::memory_order_acquire);
+    if (e != nullptr) {
+      if (e->view() == s) {
+        // fresh (if any) stays registered under its ID; a wasted ID is
+        // cheaper than unpublishing it.
+        return e->id;
+      }
+      continue;
+    }
+    // Empty slot: claim an ID and try to publish.
+    if (fresh == nullptr) {
+      std::uint32_t id = g_next_id.fetch_add(1, std::memory_order_relaxed);
+      if (id > max_ids) {
+        return 0; // table full; fall back to normal storage
+      }
+      fresh = make_entry(id, s);
+      if (fresh == nullptr) {
+        return 0;
+      }
+      g_by_id[fresh->id].store(fresh, std::memory_order_release);
+    }
+    if (slot.compare_exchange_strong(e, fresh, std::memory_order_release,
+                                     std::memory_order_acquire)) {
+      return fresh->id;
+    }
+    // Lost the race for this slot; e now holds the winner.
+    if (e != nullptr && e->view() == s) {
+      // Our claimed ID stays mapped (IDs are cheap); reuse the winner's.
+      return e->id;
+    }
+    // Different string won the slot; keep probing with our entry.
+  }
+  return 0;
+}
+
+std::string_view interned_view(std::uint32_t id) noexcept {
+  if (id == 0 || id > max_ids) {
+    return {};
+  }
+  const table_entry *e = g_by_id[id].load(std::memory_order_acquire);
+  return e != nullptr ? e->view() : std::string_view();
+}
+
+bool interning_enabled() noexcept {
+  return g_interning.load(std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+void set_message_interning(bool enabled) noexcept {
+  g_interning.store(enabled, std::memory_order_relaxed);
+}
+
+bool message_interning_enabled() noexcept {
+  return detail::interning_enabled();
+}
+
+std::uint32_t message_id(const error &err) noexcept {
+  const detail::node *n = detail::access::get(err);
+  return n != nullptr ? n->message.intern_id() : 0;
+}
+
+std::string_view interned_message(std::uint32_t id) noexcept {
+  return detail::interned_view(id);
+}
+
+std::size_t interned_message_count() noexcept {
+  std::uint32_t next = g_next_id.load(std::memory_order_relaxed);
+  std::uint32_t used = next - 1;
+  return used > max_ids ? max_ids : used;
+}
+
+} // namespace errors
@@ -0,0 +1,85 @@
+#include "errors/join.hpp"
+
+#include <string>
+#include <utility>
+
+namespace errors {
+
+struct join::entry {
+  entry *next = nullptr;
+  error err;
+};
+
+join::~join() {
+  entry *e = take_entries_reversed();
+  while (e != nullptr) {
+    entry *next = e->next;
+    delete e;
+    e = next;
+  }
+}
+
+void join::add(error err) noexcept {
+  if (!err) {
+    return;
+  }
+  auto *e = new entry;
+  e->err = std::move(err);
+  entry *head = head_.load(std::memory_order_relaxed);
+  do {
+    e->next = head;
+  } while (!head_.compare_exchange_weak(head, e, std::memory_order_release,
+                                        std::memory_order_relaxed));
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+join::entry *join::take_entries_reversed() noexcept {
+  entry *e = head_.exchange(nullptr, std::memory_order_acquire);
+  count_.store(0, std::memory_order_relaxed);
+  // The push list is LIFO; reverse it into arrival order.
+  entry *ordered = nullptr;
+  while (e != nullptr) {
+    entry *next = e->next;
+    e->next = ordered;
+    ordered = e;
+    e = next;
+  }
+  return ordered;
+}
+
+error join::collapse() {
+  entry *e = take_entries_reversed();
+  if (e == nullptr) {
+    return error();
+  }
+  if (e->next == nullptr) {
+    // A single failure collapses to itself.
+    error only = std::move(e->err);
+    delete e;
+    return only;
+  }
+  std::string combined;
+  for (entry *cur = e; cur != nullptr;) {
+    if (!combined.empty()) {
+      combined += "; ";
+    }
+    combined += cur->err.what();
+    entry *next = cur->next;
+    delete cur;
+    cur = next;
+  }
+  return new_error(std::move(combined));
+}
+
+std::vector<error> join::take_all() {
+  std::vector<error> out;
+  for (entry *e = take_entries_reversed(); e != nullptr;) {
+    out.push_back(std::move(e->err));
+    entry *next = e->next;
+    delete e;
+    e = next;
+  }
+  return out;
+}
+
+} // namespace errors
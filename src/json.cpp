@@ -0,0 +1,200 @@
+#include "errors/json.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "errors/context.hpp"
+#include "errors/format.hpp"
+#include "errors/observe.hpp"
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+// Escapes one byte that the scanner flagged: the two JSON specials and
+// the control range.
+void escape_byte(unsigned char c, std::string &out) {
+  switch (c) {
+  case '"':
+    out += "\\\"";
+    break;
+  case '\\':
+    out += "\\\\";
+    break;
+  case '\n':
+    out += "\\n";
+    break;
+  case '\r':
+    out += "\\r";
+    break;
+  case '\t':
+    out += "\\t";
+    break;
+  case '\b':
+    out += "\\b";
+    break;
+  case '\f':
+    out += "\\f";
+    break;
+  default: {
+    static constexpr char hex[] = "0123456789abcdef";
+    char buf[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+    out.append(buf, 6);
+    break;
+  }
+  }
+}
+
+constexpr bool needs_escape(unsigned char c) noexcept {
+  return c == '"' || c == '\\' || c < 0x20;
+}
+
+// Appends s with JSON escaping.  The hot path scans 16-byte blocks for
+// the first byte needing an escape and bulk-appends the clean run before
+// it; typical log messages contain no escapes at all and degrade to a
+// couple of vector compares per 16 bytes plus one append.
+void escape_append(std::string_view s, std::string &out) {
+  const char *p = s.data();
+  const char *end = p + s.size();
+  const char *run = p; // start of the current clean run
+
+#if defined(__SSE2__)
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i ctrl_max = _mm_set1_epi8(0x1F);
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(v, quote),
+                               _mm_cmpeq_epi8(v, backslash));
+    // Unsigned v <= 0x1F, expressed as min(v, 0x1F) == v so high-bit
+    // (UTF-8) bytes never false-positive the way a signed compare would.
+    hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl_max), v));
+    int mask = _mm_movemask_epi8(hit);
+    if (mask == 0) {
+      p += 16;
+      continue;
+    }
+    p += __builtin_ctz(static_cast<unsigned>(mask));
+    out.append(run, static_cast<std::size_t>(p - run));
+    escape_byte(static_cast<unsigned char>(*p), out);
+    run = ++p;
+  }
+#endif
+  while (p < end) {
+    if (needs_escape(static_cast<unsigned char>(*p))) {
+      out.append(run, static_cast<std::size_t>(p - run));
+      escape_byte(static_cast<unsigned char>(*p), out);
+      run = p + 1;
+    }
+    ++p;
+  }
+  out.append(run, static_cast<std::size_t>(end - run));
+}
+
+void append_quoted(std::string_view s, std::string &out) {
+  out += '"';
+  escape_append(s, out);
+  out += '"';
+}
+
+void append_context(std::span<const context_pair> pairs, std::string &out) {
+  out += ",\"context\":{";
+  bool first = true;
+  for (const context_pair &p : pairs) {
+    if (!first) {
+      out += ',';
+    }
+    first = false;
+    append_quoted(p.key, out);
+    out += ':';
+    switch (p.value.type()) {
+    case context_value::kind::i64:
+      out += std::to_string(p.value.as_int64());
+      break;
+    case context_value::kind::str:
+      append_quoted(p.value.as_string(), out);
+      break;
+    case context_value::kind::boolean:
+      out += p.value.as_bool() ? "true" : "false";
+      break;
+    }
+  }
+  out += '}';
+}
+
+} // namespace
+
+void to_json(const error &err, std::string &out) {
+  const detail::node *head = detail::access::get(err);
+  const static_error *sentinel = detail::access::get_static(err);
+  if (head == nullptr && sentinel == nullptr) {
+    out += "{}";
+    return;
+  }
+  detail::note_render();
+
+  out += "{\"message\":\"";
+  detail::render_pieces(
+      err,
+      [](void *sink, std::string_view piece) {
+        escape_append(piece, *static_cast<std::string *>(sink));
+      },
+      &out);
+  out += '"';
+
+  out += ",\"chain\":[";
+  bool first = true;
+  for (const detail::node *n = head; n != nullptr; n = n->cause) {
+    if (n->cause == nullptr) {
+      sentinel = n->sentinel_cause;
+    }
+    std::string_view msg = n->message.get();
+    if (msg.empty()) {
+      continue; // tagging nodes carry no message of their own
+    }
+    if (!first) {
+      out += ',';
+    }
+    first = false;
+    append_quoted(msg, out);
+  }
+  if (sentinel != nullptr) {
+    if (!first) {
+      out += ',';
+    }
+    append_quoted(sentinel->message(), out);
+  }
+  out += ']';
+
+  if (category cats = categories(err); any(cats)) {
+    out += ",\"categories\":";
+    out += std::to_string(static_cast<std::uint64_t>(cats));
+  }
+
+  if (std::span<const context_pair> pairs = context(err); !pairs.empty()) {
+    append_context(pairs, out);
+  }
+
+  if (head != nullptr && head->created_at.line() != 0) {
+    out += ",\"origin\":{\"file\":";
+    append_quoted(head->created_at.file_name(), out);
+    out += ",\"line\":";
+    out += std::to_string(head->created_at.line());
+    out += '}';
+  }
+
+  out += '}';
+}
+
+std::string to_json(const error &err) {
+  std::string out;
+  to_json(err, out);
+  return out;
+}
+
+} // namespace errors
@@ -0,0 +1,285 @@
+#ifndef ERRORS_SRC_NODE_HPP
+#define ERRORS_SRC_NODE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "errors/context.hpp"
+#include "errors/errors.hpp"
+
+namespace errors {
+
+class arena;
+
+namespace detail {
+
+/// Upper bound on captured frames per node.  Raw capture is a fixed-size
+/// array copy, so this bounds both capture cost and node size.
+inline constexpr std::size_t max_frames = 32;
+
+/// A raw, unsymbolized trace: instruction pointers only.
+struct raw_trace {
+  void *ips[max_frames];
+  std::size_t count = 0;
+};
+
+/// Interned string table (intern.cpp); see errors/intern.hpp.
+std::uint32_t intern_message(std::string_view s) noexcept;
+std::string_view interned_view(std::uint32_t id) noexcept;
+bool interning_enabled() noexcept;
+
+/// Message storage with four representations:
+///  - inline: short messages copied into an in-node buffer (no heap),
+///  - owned: a moved-in std::string (steals an rvalue's heap buffer),
+///  - view: a non-owning pointer (static strings, arena-copied bytes),
+///  - interned: a 32-bit ID into the process-wide intern table.
+class msg_storage {
+public:
+  static constexpr std::size_t inline_capacity = 40;
+
+  msg_storage() noexcept : kind_(kind::empty) {}
+
+  msg_storage(const msg_storage &) = delete;
+  msg_storage &operator=(const msg_storage &) = delete;
+
+  ~msg_storage() { clear(); }
+
+  /// Stores s inline if it fits, otherwise moves it in.
+  void assign(std::string &&s) {
+    clear();
+    if (s.size() <= inline_capacity) {
+      std::memcpy(inline_.buf, s.data(), s.size());
+      inline_.size = static_cast<std::uint8_t>(s.size());
+      kind_ = kind::inline_small;
+    } else {
+      new (&owned_) std::string(std::move(s));
+      kind_ = kind::owned;
+    }
+  }
+
+  /// Copies s into the inline buffer when it fits, otherwise onto the
+  /// heap — the allocation-free path for already-rendered bytes whose
+  /// backing buffer is about to go away.
+  void assign_copy(std::string_view s) {
+    clear();
+    if (s.size() <= inline_capacity) {
+      if (!s.empty()) { // s.data() may be null for an empty view
+        std::memcpy(inline_.buf, s.data(), s.size());
+      }
+      inline_.size = static_cast<std::uint8_t>(s.size());
+      kind_ = kind::inline_small;
+    } else {
+      new (&owned_) std::string(s);
+      kind_ = kind::owned;
+    }
+  }
+
+  /// Stores a non-owning reference; the referenced bytes must outlive
+  /// this storage.
+  void assign_view(std::string_view s) noexcept {
+    clear();
+    view_.data = s.data();
+    view_.size = s.size();
+    kind_ = kind::view;
+  }
+
+  /// Stores an intern-table ID (4 bytes instead of the string).
+  void assign_interned(std::uint32_t id) noexcept {
+    clear();
+    interned_ = id;
+    kind_ = kind::interned;
+  }
+
+  std::string_view get() const noexcept {
+    switch (kind_) {
+    case kind::inline_small:
+      return {inline_.buf, inline_.size};
+    case kind::owned:
+      return owned_;
+    case kind::view:
+      return {view_.data, view_.size};
+    case kind::interned:
+      return interned_view(interned_);
+    case kind::empty:
+      break;
+    }
+    return {};
+  }
+
+  /// Intern ID, or 0 when not interned.
+  std::uint32_t intern_id() const noexcept {
+    return kind_ == kind::interned ? interned_ : 0;
+  }
+
+  /// Heap bytes owned beyond the node itself (for budget accounting).
+  std::size_t heap_bytes() const noexcept {
+    return kind_ == kind::owned ? owned_.size() : 0;
+  }
+
+private:
+  enum class kind : std::uint8_t { empty, inline_small, owned, view, interned };
+
+  void clear() noexcept {
+    if (kind_ == kind::owned) {
+      owned_.~basic_string();
+    }
+    kind_ = kind::empty;
+  }
+
+  kind kind_;
+  union {
+    struct {
+      char buf[inline_capacity];
+      std::uint8_t size;
+    } inline_;
+    std::string owned_;
+    struct {
+      const char *data;
+      std::size_t size;
+    } view_;
+    std::uint32_t interned_;
+  };
+};
+
+/// Attached key-value context (see errors/context.hpp).  The first
+/// inline_pairs entries live in the node; past that, all pairs move to a
+/// contiguous overflow array so context() can return a single span.  The
+/// overflow comes from the node's owning arena when it has one, otherwise
+/// from the heap.
+class context_store {
+public:
+  static constexpr std::size_t inline_pairs = 4;
+
+  context_store() noexcept = default;
+
+  context_store(const context_store &) = delete;
+  context_store &operator=(const context_store &) = delete;
+
+  ~context_store();
+
+  void append(std::string_view key, context_value value, arena *a);
+
+  std::span<const context_pair> pairs() const noexcept {
+    return {overflow_ != nullptr ? overflow_ : inline_, count_};
+  }
+
+private:
+  context_pair inline_[inline_pairs] = {
+      {{}, std::int64_t{0}}, {{}, std::int64_t{0}},
+      {{}, std::int64_t{0}}, {{}, std::int64_t{0}}};
+  context_pair *overflow_ = nullptr;
+  std::uint32_t count_ = 0;
+  std::uint32_t capacity_ = inline_pairs;
+  // False when overflow_ points into an arena and must not be freed.
+  bool overflow_on_heap_ = false;
+};
+
+/// Where a node's memory came from, which decides how destroy() releases
+/// it: heap nodes are deleted, pool nodes return to the calling thread's
+/// freelist, arena nodes are finalized and freed by their arena.
+enum class node_origin : std::uint8_t { heap, pool, arena };
+
+/// One link of an error chain.  Each node holds one reference on its
+/// cause; handles (and sharing) add references on the head.  Everything
+/// set at construction is immutable afterwards, so shared chains need no
+/// locking; the lazily materialized state is guarded by lazy_lock.
+struct node {
+  // References from error handles plus (for non-head nodes) the one
+  // reference held by the wrapping node.
+  mutable std::atomic<std::uint32_t> refs{1};
+  node *cause = nullptr;
+  // Set when this node wraps a static sentinel: the chain terminates at
+  // the sentinel instead of a node.  Mutually exclusive with cause.
+  const static_error *sentinel_cause = nullptr;
+  msg_storage message;
+  raw_trace trace;
+  // Call-site origin baked in at compile time (std::source_location);
+  // line 0 until a creation function fills it.
+  std::source_location created_at;
+  context_store context;
+  // OR of this node's own bits and everything below it in the chain;
+  // maintained at construction/wrap time so queries are O(1).
+  std::uint64_t categories = 0;
+  node_origin origin = node_origin::heap;
+  // Set for arena nodes so spill allocations (context overflow) can come
+  // from the same arena as the node.
+  arena *owner = nullptr;
+
+  // Lazily materialized state, filled on first access.  The ready flags
+  // are checked lock-free (acquire); fills run under lazy_lock so
+  // concurrent readers of a shared chain never race on the fill.
+  mutable std::vector<frame> resolved;
+  mutable std::atomic<bool> symbolized{false};
+  mutable std::string rendered;
+  mutable std::atomic<bool> rendered_ready{false};
+  mutable std::atomic_flag lazy_lock = ATOMIC_FLAG_INIT;
+
+  void lock_lazy() const noexcept {
+    while (lazy_lock.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+  void unlock_lazy() const noexcept {
+    lazy_lock.clear(std::memory_order_release);
+  }
+
+  /// True if more than one handle currently references this node, in
+  /// which case in-place mutation would be visible to other holders.
+  bool shared() const noexcept {
+    return refs.load(std::memory_order_acquire) > 1;
+  }
+
+  void retain() const noexcept {
+    refs.fetch_add(1, std::memory_order_relaxed);
+  }
+};
+
+/// Library-internal bridge between the public error handle and its node.
+struct access {
+  static error make(node *n) noexcept { return error(n); }
+  static node *get(const error &e) noexcept { return e.node_ptr(); }
+  static const static_error *get_static(const error &e) noexcept {
+    return e.static_ptr();
+  }
+  static node *release(error &e) noexcept { return e.release(); }
+};
+
+/// Allocates a blank node through the regular pooled, budget-accounted
+/// creation path.  Wire deserialization must use this instead of a bare
+/// `new node`: destroy() unconditionally credits the memory governor
+/// for every node it frees, so creation has to debit it.
+node *alloc_wire_node();
+
+/// Captures up to max frames of the current call stack into out, skipping
+/// the library-internal frames.  Returns the number of frames stored.
+std::size_t capture_trace(void **out, std::size_t max) noexcept;
+
+/// Resolves raw instruction pointers into frames.  This is the expensive
+/// step (symbol lookup plus demangling) that capture defers.
+std::vector<frame> symbolize_trace(const void *const *ips, std::size_t count);
+
+/// Symbolizes n's trace if it has not been symbolized yet.
+void ensure_symbolized(const node &n);
+
+/// Appends a digest of a just-created error to the calling thread's
+/// flight-recorder ring when recording is enabled.  See errors/flight.hpp.
+void flight_note(const void *site, std::uint64_t categories,
+                 std::uint32_t intern_id);
+
+/// Pops a node-sized slot from the calling thread's pool freelist, or
+/// returns nullptr if the freelist is empty.  See errors::pool.
+void *pool_try_pop() noexcept;
+
+/// Returns a pool-originated node slot to the calling thread's freelist.
+void pool_push(void *slot) noexcept;
+
+} // namespace detail
+} // namespace errors
+
+#endif // ERRORS_SRC_NODE_HPP
@@ -0,0 +1,97 @@
+#include "errors/observe.hpp"
+
+#include <atomic>
+
+namespace errors {
+
+namespace {
+
+std::atomic<observer *> g_observer{nullptr};
+
+// Events accumulated per thread between flushes.
+constexpr std::uint64_t flush_threshold = 256;
+
+struct thread_counts {
+  std::uint64_t created = 0;
+  std::uint64_t wrapped = 0;
+  std::uint64_t rendered = 0;
+
+  std::uint64_t pending() const noexcept {
+    return created + wrapped + rendered;
+  }
+
+  void flush_to(observer *obs) noexcept {
+    if (obs == nullptr) {
+      created = wrapped = rendered = 0;
+      return;
+    }
+    if (created != 0) {
+      obs->on_create(created);
+      created = 0;
+    }
+    if (wrapped != 0) {
+      obs->on_wrap(wrapped);
+      wrapped = 0;
+    }
+    if (rendered != 0) {
+      obs->on_render(rendered);
+      rendered = 0;
+    }
+  }
+
+  ~thread_counts() {
+    // Thread exit: hand off whatever is still pending.
+    flush_to(g_observer.load(std::memory_order_acquire));
+  }
+};
+
+thread_local thread_counts t_counts;
+
+inline void maybe_flush(observer *obs) noexcept {
+  if (t_counts.pending() >= flush_threshold) {
+    t_counts.flush_to(obs);
+  }
+}
+
+} // namespace
+
+namespace detail {
+
+void note_create() noexcept {
+  observer *obs = g_observer.load(std::memory_order_relaxed);
+  if (obs == nullptr) [[likely]] {
+    return;
+  }
+  ++t_counts.created;
+  maybe_flush(obs);
+}
+
+void note_wrap() noexcept {
+  observer *obs = g_observer.load(std::memory_order_relaxed);
+  if (obs == nullptr) [[likely]] {
+    return;
+  }
+  ++t_counts.wrapped;
+  maybe_flush(obs);
+}
+
+void note_render() noexcept {
+  observer *obs = g_observer.load(std::memory_order_relaxed);
+  if (obs == nullptr) [[likely]] {
+    return;
+  }
+  ++t_counts.rendered;
+  maybe_flush(obs);
+}
+
+} // namespace detail
+
+void set_observer(observer *obs) noexcept {
+  g_observer.store(obs, std::memory_order_release);
+}
+
+void flush_observed_events() noexcept {
+  t_counts.flush_to(g_observer.load(std::memory_order_acquire));
+}
+
+} // namespace errors
@@ -0,0 +1,78 @@
+#include "errors/pool.hpp"
+
+#include <cstdlib>
+#include <new>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+// A freed slot is reused to hold the freelist link.
+struct free_slot {
+  free_slot *next;
+};
+
+static_assert(sizeof(detail::node) >= sizeof(free_slot));
+
+struct pool_state {
+  free_slot *head = nullptr;
+  std::size_t count = 0;
+
+  ~pool_state() {
+    // Thread exit: return the freelist to the heap.  Outstanding nodes
+    // created on this thread rejoin whichever thread destroys them.
+    release_all();
+  }
+
+  void release_all() noexcept {
+    while (head != nullptr) {
+      free_slot *next = head->next;
+      std::free(head);
+      head = next;
+    }
+    count = 0;
+  }
+};
+
+thread_local pool_state t_pool;
+
+} // namespace
+
+namespace detail {
+
+void *pool_try_pop() noexcept {
+  free_slot *slot = t_pool.head;
+  if (slot == nullptr) {
+    return nullptr;
+  }
+  t_pool.head = slot->next;
+  --t_pool.count;
+  return slot;
+}
+
+void pool_push(void *mem) noexcept {
+  auto *slot = static_cast<free_slot *>(mem);
+  slot->next = t_pool.head;
+  t_pool.head = slot;
+  ++t_pool.count;
+}
+
+} // namespace detail
+
+void pool::reserve(std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    void *mem = std::malloc(sizeof(detail::node));
+    if (mem == nullptr) {
+      throw std::bad_alloc();
+    }
+    detail::pool_push(mem);
+  }
+}
+
+std::size_t pool::available() noexcept { return t_pool.count; }
+
+void pool::drain() noexcept { t_pool.release_all(); }
+
+} // namespace errors
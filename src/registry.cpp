@@ -0,0 +1,123 @@
+#include "errors/registry.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace errors {
+
+namespace {
+
+// One entry per cache line: the probe for a hot code touches exactly
+// one line of the table.
+struct alignas(64) reg_slot {
+  domain_info info;
+  bool used = false;
+};
+
+// An immutable lookup table.  Registration builds a fresh snapshot and
+// publishes it with one pointer store; readers never see a table under
+// mutation.  Capacity is a power of two kept at most half full, so a
+// linear probe always terminates at an empty slot.
+struct reg_snapshot {
+  std::vector<reg_slot> table;
+  std::vector<std::string> names; // owns the name bytes the slots view
+  std::size_t mask = 0;
+  std::size_t count = 0;
+  // The snapshot this one replaced.  Superseded snapshots are never
+  // freed — a reader may still hold a pointer into one — but stay
+  // reachable through this chain, so they are retained state rather
+  // than leaks.  Its length is the number of rebuilds, which batching
+  // keeps at a handful for a normal startup.
+  const reg_snapshot *retired = nullptr;
+};
+
+std::atomic<const reg_snapshot *> g_registry{nullptr};
+std::mutex g_registry_write;
+
+std::size_t slot_of(std::uint64_t code, std::size_t mask) noexcept {
+  return static_cast<std::size_t>(code * 0x9E3779B97F4A7C15ULL >> 32) & mask;
+}
+
+// Inserts into a snapshot under construction (writer-only, pre-sized).
+void place(reg_snapshot &s, std::uint64_t code, std::string_view name,
+           category categories) {
+  for (std::size_t i = slot_of(code, s.mask);; i = (i + 1) & s.mask) {
+    reg_slot &sl = s.table[i];
+    if (sl.used && sl.info.code != code) {
+      continue;
+    }
+    if (!sl.used) {
+      s.names.push_back(std::string(name));
+      ++s.count;
+    } else {
+      // Re-registration: reuse the owned name storage slot.
+      s.names.push_back(std::string(name));
+    }
+    sl.info = {code, s.names.back(), categories};
+    sl.used = true;
+    return;
+  }
+}
+
+} // namespace
+
+void register_domains(std::span<const domain_info> domains) {
+  std::lock_guard<std::mutex> lock(g_registry_write);
+  const reg_snapshot *old = g_registry.load(std::memory_order_relaxed);
+  std::size_t count = (old != nullptr ? old->count : 0) + domains.size();
+  if (count == 0) {
+    return;
+  }
+
+  auto *fresh = new reg_snapshot;
+  std::size_t capacity = 16;
+  while (capacity < count * 2) {
+    capacity *= 2;
+  }
+  fresh->table.resize(capacity);
+  fresh->mask = capacity - 1;
+  // Name views point into this vector's strings; reserving the final
+  // size up front keeps them stable while the snapshot is filled.
+  fresh->names.reserve(count);
+  if (old != nullptr) {
+    for (const reg_slot &sl : old->table) {
+      if (sl.used) {
+        place(*fresh, sl.info.code, sl.info.name, sl.info.categories);
+      }
+    }
+  }
+  for (const domain_info &d : domains) {
+    if (d.code != 0) { // 0 marks empty slots; not a registrable code
+      place(*fresh, d.code, d.name, d.categories);
+    }
+  }
+
+  fresh->retired = old;
+  g_registry.store(fresh, std::memory_order_release);
+}
+
+void register_domain(std::uint64_t code, std::string_view name,
+                     category categories) {
+  domain_info d{code, name, categories};
+  register_domains({&d, 1});
+}
+
+const domain_info *find_domain(std::uint64_t code) noexcept {
+  const reg_snapshot *s = g_registry.load(std::memory_order_acquire);
+  if (s == nullptr || code == 0) {
+    return nullptr;
+  }
+  for (std::size_t i = slot_of(code, s->mask);; i = (i + 1) & s->mask) {
+    const reg_slot &sl = s->table[i];
+    if (!sl.used) {
+      return nullptr;
+    }
+    if (sl.info.code == code) {
+      return &sl.info;
+    }
+  }
+}
+
+} // namespace errors
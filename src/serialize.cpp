@@ -0,0 +1,383 @@
+#include "errors/serialize.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "node.hpp"
+
+namespace errors {
+
+namespace {
+
+constexpr char wire_magic = 'E';
+constexpr char wire_version = 2;
+
+// Node flags.
+constexpr std::uint8_t flag_sentinel = 0x01;
+
+// Depth guard against corrupt counts; real chains are a handful deep.
+constexpr std::uint32_t max_wire_nodes = 1024;
+
+// Batch stream framing.
+constexpr char batch_magic = 'B';
+constexpr char batch_version = 1;
+constexpr std::uint32_t max_wire_errors = 1u << 20;
+
+void put_varint(std::string &out, std::uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<char>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<char>(value));
+}
+
+bool get_varint(std::string_view &in, std::uint64_t &value) {
+  value = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    if (in.empty()) {
+      return false;
+    }
+    std::uint8_t byte = static_cast<std::uint8_t>(in.front());
+    in.remove_prefix(1);
+    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool get_bytes(std::string_view &in, std::size_t n, std::string_view &out) {
+  if (in.size() < n) {
+    return false;
+  }
+  out = in.substr(0, n);
+  in.remove_prefix(n);
+  return true;
+}
+
+void put_message(std::string &out, std::string_view message) {
+  put_varint(out, message.size());
+  out.append(message);
+}
+
+void put_trace(std::string &out, const detail::raw_trace &trace) {
+  put_varint(out, trace.count);
+  for (std::size_t i = 0; i < trace.count; ++i) {
+    std::uint64_t ip = reinterpret_cast<std::uintptr_t>(trace.ips[i]);
+    char bytes[8];
+    std::memcpy(bytes, &ip, sizeof(ip));
+    out.append(bytes, sizeof(bytes));
+  }
+}
+
+} // namespace
+
+void serialize(const error &err, std::string &out) {
+  out.push_back(wire_magic);
+  out.push_back(wire_version);
+
+  // Count levels: nodes plus a possible sentinel terminator.
+  const detail::node *head = detail::access::get(err);
+  const static_error *direct = detail::access::get_static(err);
+  std::uint64_t count = direct != nullptr ? 1 : 0;
+  const static_error *tail_sentinel = nullptr;
+  for (const detail::node *n = head; n != nullptr; n = n->cause) {
+    ++count;
+    if (n->cause == nullptr) {
+      tail_sentinel = n->sentinel_cause;
+    }
+  }
+  if (tail_sentinel != nullptr) {
+    ++count;
+  }
+  put_varint(out, count);
+
+  for (const detail::node *n = head; n != nullptr; n = n->cause) {
+    out.push_back(0);
+    put_varint(out, n->categories);
+    put_message(out, n->message.get());
+    put_trace(out, n->trace);
+  }
+  const static_error *s = direct != nullptr ? direct : tail_sentinel;
+  if (s != nullptr) {
+    out.push_back(static_cast<char>(flag_sentinel));
+    put_varint(out, static_cast<std::uint64_t>(s->categories()));
+    put_message(out, s->message());
+  }
+}
+
+std::string serialize(const error &err) {
+  std::string out;
+  serialize(err, out);
+  return out;
+}
+
+error deserialize(std::string_view buffer, error &out) {
+  out = error();
+  std::string_view in = buffer;
+  if (in.size() < 2 || in[0] != wire_magic || in[1] != wire_version) {
+    return wrap(error(bad_wire_format), "bad header");
+  }
+  in.remove_prefix(2);
+
+  std::uint64_t count = 0;
+  if (!get_varint(in, count) || count > max_wire_nodes) {
+    return wrap(error(bad_wire_format), "bad node count");
+  }
+
+  detail::node *head = nullptr;
+  detail::node **tail = &head;
+  for (std::uint64_t i = 0; i < count; ++i) {
+    std::uint64_t flags = 0;
+    std::uint64_t cats = 0;
+    std::uint64_t msg_len = 0;
+    std::string_view message;
+    if (in.empty() || !get_varint(in, flags) || !get_varint(in, cats) ||
+        !get_varint(in, msg_len) || !get_bytes(in, msg_len, message)) {
+      detail::destroy(head);
+      return wrap(error(bad_wire_format), "truncated node");
+    }
+    detail::node *n = detail::alloc_wire_node();
+    // Zero-copy: the node views the caller's buffer.
+    n->message.assign_view(message);
+    n->categories = cats;
+    *tail = n;
+    tail = &n->cause;
+    if ((flags & flag_sentinel) != 0) {
+      // Sentinel identity does not cross the wire; the level survives as
+      // a plain message node.
+      continue;
+    }
+    std::uint64_t frames = 0;
+    if (!get_varint(in, frames) || frames > detail::max_frames) {
+      detail::destroy(head);
+      return wrap(error(bad_wire_format), "bad frame count");
+    }
+    for (std::uint64_t f = 0; f < frames; ++f) {
+      std::string_view bytes;
+      if (!get_bytes(in, 8, bytes)) {
+        detail::destroy(head);
+        return wrap(error(bad_wire_format), "truncated trace");
+      }
+      std::uint64_t ip = 0;
+      std::memcpy(&ip, bytes.data(), sizeof(ip));
+      n->trace.ips[n->trace.count++] =
+          reinterpret_cast<void *>(static_cast<std::uintptr_t>(ip));
+    }
+  }
+  out = detail::access::make(head);
+  return error();
+}
+
+void serialize_batch(std::span<const error> batch, std::string &out) {
+  out.push_back(batch_magic);
+  out.push_back(batch_version);
+
+  // First pass: intern every message and trace frame across the batch.
+  //
+  // Traces dedupe through a tree keyed on (parent, address), built from
+  // the main-side end of each trace inward, so errors captured below the
+  // same call path share their common prefix as one entry per frame.
+  // A trace is then a single back-reference to its leaf entry.
+  struct level_rec {
+    std::uint8_t flags;
+    std::uint64_t categories;
+    std::uint32_t msg;
+    std::uint32_t trace_ref; // 1-based tree entry; 0 = no trace
+  };
+  struct tree_entry {
+    std::uint32_t parent;
+    std::uint64_t ip;
+  };
+  std::vector<std::string_view> messages;
+  std::unordered_map<std::string_view, std::uint32_t> msg_index;
+  auto intern_msg = [&](std::string_view m) {
+    auto [it, fresh] =
+        msg_index.try_emplace(m, static_cast<std::uint32_t>(messages.size()));
+    if (fresh) {
+      messages.push_back(m);
+    }
+    return it->second;
+  };
+  std::vector<tree_entry> tree;
+  std::map<std::pair<std::uint32_t, std::uint64_t>, std::uint32_t> tree_index;
+  auto intern_frame = [&](std::uint32_t parent, std::uint64_t ip) {
+    auto [it, fresh] = tree_index.try_emplace(
+        {parent, ip}, static_cast<std::uint32_t>(tree.size() + 1));
+    if (fresh) {
+      tree.push_back({parent, ip});
+    }
+    return it->second;
+  };
+
+  std::vector<level_rec> levels;
+  std::vector<std::uint32_t> level_counts;
+  for (const error &err : batch) {
+    std::uint32_t count = 0;
+    const detail::node *head = detail::access::get(err);
+    const static_error *direct = detail::access::get_static(err);
+    const static_error *tail_sentinel = nullptr;
+    for (const detail::node *n = head; n != nullptr; n = n->cause) {
+      level_rec l{0, n->categories, intern_msg(n->message.get()), 0};
+      std::uint32_t ref = 0;
+      for (std::size_t i = n->trace.count; i > 0; --i) {
+        ref = intern_frame(
+            ref, reinterpret_cast<std::uintptr_t>(n->trace.ips[i - 1]));
+      }
+      l.trace_ref = ref;
+      levels.push_back(l);
+      ++count;
+      if (n->cause == nullptr) {
+        tail_sentinel = n->sentinel_cause;
+      }
+    }
+    const static_error *s = direct != nullptr ? direct : tail_sentinel;
+    if (s != nullptr) {
+      levels.push_back({flag_sentinel,
+                        static_cast<std::uint64_t>(s->categories()),
+                        intern_msg(s->message()), 0});
+      ++count;
+    }
+    level_counts.push_back(count);
+  }
+
+  // Second pass: tables first, then the per-error records referencing
+  // them.
+  put_varint(out, messages.size());
+  for (std::string_view m : messages) {
+    put_message(out, m);
+  }
+  put_varint(out, tree.size());
+  for (const tree_entry &e : tree) {
+    put_varint(out, e.parent);
+    char bytes[8];
+    std::memcpy(bytes, &e.ip, sizeof(e.ip));
+    out.append(bytes, sizeof(bytes));
+  }
+  put_varint(out, level_counts.size());
+  std::size_t cursor = 0;
+  for (std::uint32_t count : level_counts) {
+    put_varint(out, count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+      const level_rec &l = levels[cursor++];
+      out.push_back(static_cast<char>(l.flags));
+      put_varint(out, l.categories);
+      put_varint(out, l.msg);
+      if ((l.flags & flag_sentinel) == 0) {
+        put_varint(out, l.trace_ref);
+      }
+    }
+  }
+}
+
+std::string serialize_batch(std::span<const error> batch) {
+  std::string out;
+  serialize_batch(batch, out);
+  return out;
+}
+
+error deserialize_batch(std::string_view buffer, std::vector<error> &out) {
+  out.clear();
+  std::string_view in = buffer;
+  if (in.size() < 2 || in[0] != batch_magic || in[1] != batch_version) {
+    return wrap(error(bad_wire_format), "bad batch header");
+  }
+  in.remove_prefix(2);
+
+  std::uint64_t msg_count = 0;
+  if (!get_varint(in, msg_count) || msg_count > in.size()) {
+    return wrap(error(bad_wire_format), "bad message table");
+  }
+  std::vector<std::string_view> messages;
+  messages.reserve(msg_count);
+  for (std::uint64_t i = 0; i < msg_count; ++i) {
+    std::uint64_t len = 0;
+    std::string_view m;
+    if (!get_varint(in, len) || !get_bytes(in, len, m)) {
+      return wrap(error(bad_wire_format), "truncated message table");
+    }
+    messages.push_back(m);
+  }
+
+  struct tree_entry {
+    std::uint32_t parent;
+    std::uint64_t ip;
+  };
+  std::uint64_t tree_count = 0;
+  if (!get_varint(in, tree_count) || tree_count > in.size() / 9) {
+    return wrap(error(bad_wire_format), "bad trace table");
+  }
+  std::vector<tree_entry> tree;
+  tree.reserve(tree_count);
+  for (std::uint64_t i = 0; i < tree_count; ++i) {
+    std::uint64_t parent = 0;
+    std::string_view bytes;
+    // Parents always precede their children, which also rules out
+    // cycles when walking a back-reference below.
+    if (!get_varint(in, parent) || parent > i || !get_bytes(in, 8, bytes)) {
+      return wrap(error(bad_wire_format), "truncated trace table");
+    }
+    std::uint64_t ip = 0;
+    std::memcpy(&ip, bytes.data(), sizeof(ip));
+    tree.push_back({static_cast<std::uint32_t>(parent), ip});
+  }
+
+  std::uint64_t error_count = 0;
+  if (!get_varint(in, error_count) || error_count > max_wire_errors) {
+    return wrap(error(bad_wire_format), "bad error count");
+  }
+  auto fail = [&](const char *what) {
+    out.clear();
+    return wrap(error(bad_wire_format), what);
+  };
+  for (std::uint64_t e = 0; e < error_count; ++e) {
+    std::uint64_t count = 0;
+    if (!get_varint(in, count) || count > max_wire_nodes) {
+      return fail("bad node count");
+    }
+    detail::node *head = nullptr;
+    detail::node **tail = &head;
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::uint64_t flags = 0;
+      std::uint64_t cats = 0;
+      std::uint64_t msg = 0;
+      if (in.empty() || !get_varint(in, flags) || !get_varint(in, cats) ||
+          !get_varint(in, msg) || msg >= messages.size()) {
+        detail::destroy(head);
+        return fail("truncated node");
+      }
+      detail::node *n = detail::alloc_wire_node();
+      n->message.assign_view(messages[msg]);
+      n->categories = cats;
+      *tail = n;
+      tail = &n->cause;
+      if ((flags & flag_sentinel) != 0) {
+        continue;
+      }
+      std::uint64_t ref = 0;
+      if (!get_varint(in, ref) || ref > tree.size()) {
+        detail::destroy(head);
+        return fail("bad trace reference");
+      }
+      while (ref != 0) {
+        if (n->trace.count == detail::max_frames) {
+          detail::destroy(head);
+          return fail("bad trace depth");
+        }
+        const tree_entry &entry = tree[ref - 1];
+        n->trace.ips[n->trace.count++] =
+            reinterpret_cast<void *>(static_cast<std::uintptr_t>(entry.ip));
+        ref = entry.parent;
+      }
+    }
+    out.push_back(detail::access::make(head));
+  }
+  return error();
+}
+
+} // namespace errors
@@ -0,0 +1,248 @@
+#include "symindex.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <cxxabi.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "errors/symbolize.hpp"
+
+namespace errors {
+
+namespace detail {
+
+namespace {
+
+std::string demangle_name(const char *name) {
+  int status = 0;
+  char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status != 0 || demangled == nullptr) {
+    return name;
+  }
+  std::string result(demangled);
+  std::free(demangled);
+  return result;
+}
+
+// A loaded, mmap'd index.  Immutable once published; pages in on demand.
+struct loaded_index {
+  const symindex_header *header;
+  const symindex_entry *entries;
+  const char *strings;
+  // Subtracted from a raw ip before the binary search (the main
+  // program's relocation base for ET_DYN binaries, 0 for ET_EXEC).
+  std::uintptr_t bias;
+};
+
+std::atomic<const loaded_index *> g_index{nullptr};
+
+// Relocation base of the main program, from its phdr entry (dlpi_addr is
+// 0 for non-PIE executables, which matches addresses_absolute).
+std::uintptr_t main_program_base() noexcept {
+  std::uintptr_t base = 0;
+  ::dl_iterate_phdr(
+      [](struct dl_phdr_info *info, std::size_t, void *out) {
+        *static_cast<std::uintptr_t *>(out) = info->dlpi_addr;
+        return 1; // first entry is the main program
+      },
+      &base);
+  return base;
+}
+
+// When a symbol carries no size, accept ips within this many bytes of
+// its start rather than attributing them to an arbitrary distance.
+constexpr std::uint64_t sizeless_symbol_span = 4096;
+
+} // namespace
+
+error write_symbol_index(std::string_view binary_path,
+                         std::string_view out_path) {
+  std::string path(binary_path);
+  std::FILE *in = std::fopen(path.c_str(), "rb");
+  if (in == nullptr) {
+    return new_error("symindex: cannot open " + path);
+  }
+  std::fseek(in, 0, SEEK_END);
+  long file_size = std::ftell(in);
+  std::fseek(in, 0, SEEK_SET);
+  std::vector<unsigned char> image(static_cast<std::size_t>(file_size));
+  std::size_t got = std::fread(image.data(), 1, image.size(), in);
+  std::fclose(in);
+  if (got != image.size() || image.size() < sizeof(Elf64_Ehdr)) {
+    return new_error("symindex: short read from " + path);
+  }
+
+  const auto *ehdr = reinterpret_cast<const Elf64_Ehdr *>(image.data());
+  if (std::memcmp(ehdr->e_ident, ELFMAG, SELFMAG) != 0 ||
+      ehdr->e_ident[EI_CLASS] != ELFCLASS64) {
+    return new_error("symindex: not a 64-bit ELF binary: " + path);
+  }
+
+  // Prefer the full .symtab (static functions included); fall back to
+  // .dynsym for stripped binaries that still export dynamic symbols.
+  const auto *shdrs =
+      reinterpret_cast<const Elf64_Shdr *>(image.data() + ehdr->e_shoff);
+  const Elf64_Shdr *symtab = nullptr;
+  for (unsigned kind : {SHT_SYMTAB, SHT_DYNSYM}) {
+    for (int i = 0; i < ehdr->e_shnum && symtab == nullptr; ++i) {
+      if (shdrs[i].sh_type == kind) {
+        symtab = &shdrs[i];
+      }
+    }
+    if (symtab != nullptr) {
+      break;
+    }
+  }
+  if (symtab == nullptr) {
+    return new_error("symindex: no symbol table in " + path);
+  }
+  const Elf64_Shdr &strtab = shdrs[symtab->sh_link];
+  const char *names =
+      reinterpret_cast<const char *>(image.data() + strtab.sh_offset);
+  const auto *syms =
+      reinterpret_cast<const Elf64_Sym *>(image.data() + symtab->sh_offset);
+  std::size_t sym_count = symtab->sh_size / sizeof(Elf64_Sym);
+
+  // Demangle at build time so the runtime path is a binary search plus a
+  // string copy — no demangler, no DWARF.
+  std::vector<symindex_entry> entries;
+  std::string strings;
+  strings.append(path);
+  strings.push_back('\0');
+  for (std::size_t i = 0; i < sym_count; ++i) {
+    const Elf64_Sym &sym = syms[i];
+    if (ELF64_ST_TYPE(sym.st_info) != STT_FUNC || sym.st_value == 0 ||
+        sym.st_name == 0) {
+      continue;
+    }
+    symindex_entry e;
+    e.addr = sym.st_value;
+    e.size = static_cast<std::uint32_t>(sym.st_size);
+    e.name_off = static_cast<std::uint32_t>(strings.size());
+    strings.append(demangle_name(names + sym.st_name));
+    strings.push_back('\0');
+    entries.push_back(e);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const symindex_entry &a, const symindex_entry &b) {
+              return a.addr < b.addr;
+            });
+  entries.erase(std::unique(entries.begin(), entries.end(),
+                            [](const symindex_entry &a,
+                               const symindex_entry &b) {
+                              return a.addr == b.addr;
+                            }),
+                entries.end());
+
+  symindex_header header = {};
+  std::memcpy(header.magic, "ESIX", 4);
+  header.version = symindex_version;
+  header.entry_count = entries.size();
+  header.strings_size = strings.size();
+  header.addresses_absolute = ehdr->e_type == ET_EXEC ? 1 : 0;
+
+  std::string out(out_path);
+  std::FILE *dst = std::fopen(out.c_str(), "wb");
+  if (dst == nullptr) {
+    return new_error("symindex: cannot create " + out);
+  }
+  bool ok =
+      std::fwrite(&header, sizeof(header), 1, dst) == 1 &&
+      (entries.empty() ||
+       std::fwrite(entries.data(), sizeof(symindex_entry), entries.size(),
+                   dst) == entries.size()) &&
+      std::fwrite(strings.data(), 1, strings.size(), dst) == strings.size();
+  ok = std::fclose(dst) == 0 && ok;
+  if (!ok) {
+    return new_error("symindex: write failed for " + out);
+  }
+  return error();
+}
+
+bool symindex_lookup(const void *ip, frame &f) noexcept {
+  const loaded_index *idx = g_index.load(std::memory_order_acquire);
+  if (idx == nullptr || idx->header->entry_count == 0) {
+    return false;
+  }
+  std::uint64_t target = reinterpret_cast<std::uintptr_t>(ip) - idx->bias;
+  const symindex_entry *begin = idx->entries;
+  const symindex_entry *end = begin + idx->header->entry_count;
+  // Greatest entry with addr <= target.
+  const symindex_entry *it = std::upper_bound(
+      begin, end, target, [](std::uint64_t t, const symindex_entry &e) {
+        return t < e.addr;
+      });
+  if (it == begin) {
+    return false;
+  }
+  --it;
+  std::uint64_t span = it->size != 0 ? it->size : sizeless_symbol_span;
+  if (target - it->addr >= span) {
+    return false;
+  }
+  f.ip = ip;
+  f.function = idx->strings + it->name_off;
+  f.object = idx->strings; // indexed binary path, at blob offset 0
+  f.offset = static_cast<std::uintptr_t>(target);
+  return true;
+}
+
+} // namespace detail
+
+error load_symbol_index(std::string_view path) {
+  std::string p(path);
+  int fd = ::open(p.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return new_error("symindex: cannot open " + p);
+  }
+  struct stat st = {};
+  if (::fstat(fd, &st) != 0 ||
+      static_cast<std::size_t>(st.st_size) < sizeof(detail::symindex_header)) {
+    ::close(fd);
+    return new_error("symindex: not an index file: " + p);
+  }
+  void *mapped =
+      ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ,
+             MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    return new_error("symindex: mmap failed for " + p);
+  }
+
+  const auto *header = static_cast<const detail::symindex_header *>(mapped);
+  std::size_t expected = sizeof(detail::symindex_header) +
+                         header->entry_count * sizeof(detail::symindex_entry) +
+                         header->strings_size;
+  if (std::memcmp(header->magic, "ESIX", 4) != 0 ||
+      header->version != detail::symindex_version ||
+      static_cast<std::size_t>(st.st_size) < expected) {
+    ::munmap(mapped, static_cast<std::size_t>(st.st_size));
+    return new_error("symindex: bad index file: " + p);
+  }
+
+  auto *idx = new detail::loaded_index;
+  idx->header = header;
+  idx->entries = reinterpret_cast<const detail::symindex_entry *>(header + 1);
+  idx->strings = reinterpret_cast<const char *>(idx->entries +
+                                                header->entry_count);
+  idx->bias =
+      header->addresses_absolute != 0 ? 0 : detail::main_program_base();
+
+  // Replace any previous index; the old mapping is intentionally leaked
+  // (lock-free readers may still hold it, and loads are one-per-process
+  // in practice).
+  detail::g_index.store(idx, std::memory_order_release);
+  return error();
+}
+
+} // namespace errors
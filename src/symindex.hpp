@@ -0,0 +1,47 @@
+#ifndef ERRORS_SRC_SYMINDEX_HPP
+#define ERRORS_SRC_SYMINDEX_HPP
+
+#include <cstdint>
+#include <string_view>
+
+#include "errors/errors.hpp"
+
+namespace errors::detail {
+
+/// On-disk layout of a symbol index (see errors/symbolize.hpp and the
+/// errors-symindex tool).  A file is one header, entry_count entries
+/// sorted by address, then a NUL-separated string blob.  The first blob
+/// string (offset 0) is the path of the indexed binary; function names
+/// are stored pre-demangled so the runtime never calls the demangler.
+struct symindex_header {
+  char magic[4]; // "ESIX"
+  std::uint32_t version;
+  std::uint64_t entry_count;
+  std::uint64_t strings_size;
+  // Nonzero when the binary is ET_EXEC: symbol addresses are absolute
+  // virtual addresses.  Zero (ET_DYN) means addresses are offsets from
+  // the load base.
+  std::uint8_t addresses_absolute;
+  std::uint8_t reserved[7];
+};
+
+struct symindex_entry {
+  std::uint64_t addr;
+  std::uint32_t size; // 0 when the symbol table carried no size
+  std::uint32_t name_off;
+};
+
+inline constexpr std::uint32_t symindex_version = 1;
+
+/// Builds an index file for binary_path at out_path.  Used by the
+/// errors-symindex build tool and by tests.
+error write_symbol_index(std::string_view binary_path,
+                         std::string_view out_path);
+
+/// Fills f from the loaded index; false when no index is loaded or ip is
+/// not covered.
+bool symindex_lookup(const void *ip, frame &f) noexcept;
+
+} // namespace errors::detail
+
+#endif // ERRORS_SRC_SYMINDEX_HPP
@@ -0,0 +1,367 @@
+#include "node.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <sched.h>
+
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+
+#include "errors/symbolize.hpp"
+#include "symindex.hpp"
+
+namespace errors::detail {
+
+namespace {
+
+// Frames belonging to the library itself (capture_trace, make_node,
+// new_error/wrap) that sit on top of the caller's frames.
+constexpr std::size_t skip_frames = 3;
+
+std::string demangle(const char *name) {
+  int status = 0;
+  char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status != 0 || demangled == nullptr) {
+    return name;
+  }
+  std::string result(demangled);
+  std::free(demangled);
+  return result;
+}
+
+frame resolve_uncached(const void *ip) {
+  frame f;
+  // A preloaded symbol index (errors-symindex) answers with a binary
+  // search and a pre-demangled name; dladdr is the fallback.
+  if (symindex_lookup(ip, f)) {
+    return f;
+  }
+  f.ip = ip;
+  Dl_info info;
+  if (::dladdr(ip, &info) != 0) {
+    if (info.dli_sname != nullptr) {
+      f.function = demangle(info.dli_sname);
+    }
+    if (info.dli_fname != nullptr) {
+      f.object = info.dli_fname;
+    }
+    if (info.dli_fbase != nullptr) {
+      f.offset = reinterpret_cast<std::uintptr_t>(ip) -
+                 reinterpret_cast<std::uintptr_t>(info.dli_fbase);
+    }
+  }
+  return f;
+}
+
+// Process-wide ip -> frame cache.  Errors originate from a handful of
+// hot call sites, so the same addresses resolve over and over; the
+// expensive dladdr+demangle runs once per unique address.
+//
+// Sharded open-addressing tables of immutable, never-freed entries.  The
+// read path is a hash probe over atomic slots with no lock; writers
+// serialize per shard and publish entries with a release store.
+struct cache_entry {
+  const void *ip;
+  frame resolved;
+};
+
+constexpr std::size_t cache_shards = 16;
+constexpr std::size_t shard_slots = 1024; // power of two, probed linearly
+
+struct alignas(64) cache_shard {
+  std::atomic<const cache_entry *> slots[shard_slots] = {};
+  std::mutex write_mutex;
+};
+
+// The cache is replicated per NUMA node: during an error storm both
+// sockets symbolize concurrently, and a single shared table plateaus on
+// cross-socket coherence traffic for its hot lines.  Each node fills its
+// own replica (duplicating the occasional dladdr call, which is cheap
+// next to the bouncing it avoids) and only ever touches local memory
+// afterwards.
+struct cache_replica {
+  cache_shard shards[cache_shards];
+};
+
+struct numa_topology {
+  std::size_t nodes = 1;
+  // cpu -> node, sized to the possible cpus; empty on single-node hosts.
+  std::vector<std::uint8_t> cpu_to_node;
+};
+
+// Parses "0-15,32-47" style cpulist files.
+void mark_cpulist(const char *list, std::uint8_t node,
+                  std::vector<std::uint8_t> &map) {
+  const char *p = list;
+  while (*p != '\0' && *p != '\n') {
+    char *end = nullptr;
+    long lo = std::strtol(p, &end, 10);
+    long hi = lo;
+    if (*end == '-') {
+      hi = std::strtol(end + 1, &end, 10);
+    }
+    for (long cpu = lo; cpu >= 0 && cpu <= hi; ++cpu) {
+      if (static_cast<std::size_t>(cpu) >= map.size()) {
+        map.resize(static_cast<std::size_t>(cpu) + 1, 0);
+      }
+      map[static_cast<std::size_t>(cpu)] = node;
+    }
+    p = *end == ',' ? end + 1 : end;
+  }
+}
+
+numa_topology detect_numa_topology() {
+  numa_topology topo;
+  for (std::size_t n = 0;; ++n) {
+    char path[64];
+    std::snprintf(path, sizeof(path),
+                  "/sys/devices/system/node/node%zu/cpulist", n);
+    std::FILE *f = std::fopen(path, "re");
+    if (f == nullptr) {
+      topo.nodes = n > 0 ? n : 1;
+      break;
+    }
+    char list[4096];
+    if (std::fgets(list, sizeof(list), f) != nullptr) {
+      mark_cpulist(list, static_cast<std::uint8_t>(n), topo.cpu_to_node);
+    }
+    std::fclose(f);
+  }
+  if (topo.nodes <= 1) {
+    topo.cpu_to_node.clear(); // single node: skip the per-lookup getcpu
+  }
+  return topo;
+}
+
+const numa_topology &topology() {
+  static const numa_topology topo = detect_numa_topology();
+  return topo;
+}
+
+// Replicas live for the process lifetime; allocated on first use so
+// single-threaded early symbolization doesn't pay for detection.
+cache_replica *replicas() {
+  static cache_replica *const r = new cache_replica[topology().nodes];
+  return r;
+}
+
+cache_replica &local_replica() {
+  const numa_topology &topo = topology();
+  cache_replica *all = replicas();
+  if (topo.nodes <= 1) {
+    return all[0];
+  }
+  int cpu = ::sched_getcpu();
+  if (cpu < 0 || static_cast<std::size_t>(cpu) >= topo.cpu_to_node.size()) {
+    return all[0];
+  }
+  return all[topo.cpu_to_node[static_cast<std::size_t>(cpu)]];
+}
+
+std::atomic<std::uint64_t> g_lookups{0};
+std::atomic<std::uint64_t> g_hits{0};
+std::atomic<std::uint64_t> g_uncached{0};
+
+std::size_t ip_hash(const void *ip) noexcept {
+  // Fibonacci hashing; code addresses share low and high bits.
+  return static_cast<std::size_t>(
+      reinterpret_cast<std::uintptr_t>(ip) * 0x9E3779B97F4A7C15ULL >> 16);
+}
+
+frame resolve_cached(const void *ip) {
+  g_lookups.fetch_add(1, std::memory_order_relaxed);
+  std::size_t hash = ip_hash(ip);
+  cache_shard &shard = local_replica().shards[hash % cache_shards];
+  std::size_t idx = (hash / cache_shards) & (shard_slots - 1);
+
+  // Lock-free read probe.
+  for (std::size_t i = 0; i < shard_slots; ++i) {
+    const cache_entry *e =
+        shard.slots[(idx + i) & (shard_slots - 1)].load(
+            std::memory_order_acquire);
+    if (e == nullptr) {
+      break; // not cached yet
+    }
+    if (e->ip == ip) {
+      g_hits.fetch_add(1, std::memory_order_relaxed);
+      return e->resolved;
+    }
+  }
+
+  frame f = resolve_uncached(ip);
+
+  // Publish; writers serialize per shard.  Entries are immutable and
+  // live for the process lifetime, so readers never need a lock.
+  std::lock_guard<std::mutex> lock(shard.write_mutex);
+  for (std::size_t i = 0; i < shard_slots; ++i) {
+    std::atomic<const cache_entry *> &slot =
+        shard.slots[(idx + i) & (shard_slots - 1)];
+    const cache_entry *e = slot.load(std::memory_order_relaxed);
+    if (e == nullptr) {
+      auto *fresh = new cache_entry{ip, f};
+      slot.store(fresh, std::memory_order_release);
+      return f;
+    }
+    if (e->ip == ip) {
+      return f; // raced with another writer
+    }
+  }
+  // Shard full; serve uncached from now on.
+  g_uncached.fetch_add(1, std::memory_order_relaxed);
+  return f;
+}
+
+} // namespace
+
+std::atomic<std::size_t> g_max_depth{max_frames};
+
+// Generic unwinder path.  This is the only unwinder in the default
+// build, and the frame-pointer build still needs it for capture_raw():
+// the fp walk cannot cross the kernel's signal frame, while libgcc's
+// CFI-driven unwinder can.
+std::size_t backtrace_capture(void **out, std::size_t max,
+                              std::size_t skip) noexcept {
+  void *buffer[max_frames + skip_frames + 1];
+  int captured = ::backtrace(buffer, static_cast<int>(max + skip));
+  if (captured <= static_cast<int>(skip)) {
+    return 0;
+  }
+  std::size_t count = static_cast<std::size_t>(captured) - skip;
+  if (count > max) {
+    count = max;
+  }
+  std::memcpy(out, buffer + skip, count * sizeof(void *));
+  return count;
+}
+
+// backtrace() lazily initializes libgcc's unwinder on first use, which
+// can allocate and lock; run it once at load so capture_raw() stays
+// async-signal-safe afterwards.
+const bool g_unwinder_warmed = [] {
+  void *dummy[2];
+  (void)::backtrace(dummy, 2);
+  return true;
+}();
+
+#ifdef ERRORS_FRAME_POINTER_UNWIND
+
+// Fast path: walk saved frame pointers directly.  Only valid when the
+// whole application is built with -fno-omit-frame-pointer, which the
+// ERRORS_FRAME_POINTER_UNWIND build option enforces for the library and
+// propagates to dependents.
+struct fp_link {
+  fp_link *next;
+  void *ret;
+};
+
+// Frames between the caller of new_error()/wrap() and this function on
+// the frame-pointer chain (capture_trace itself is not on it).
+constexpr std::size_t fp_skip_frames = 2;
+
+[[gnu::noinline]] std::size_t capture_trace_impl(void **out, std::size_t max,
+                                                 std::size_t skip) noexcept {
+  const fp_link *fp = static_cast<const fp_link *>(__builtin_frame_address(0));
+  std::uintptr_t prev = 0;
+  std::size_t seen = 0;
+  std::size_t count = 0;
+  while (fp != nullptr && count < max) {
+    std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(fp);
+    // Frame pointers must be aligned and strictly grow toward the stack
+    // base; anything else means the chain is broken.
+    if (addr <= prev || (addr & (sizeof(void *) - 1)) != 0) {
+      break;
+    }
+    if (fp->ret == nullptr) {
+      break;
+    }
+    if (seen >= skip) {
+      out[count++] = fp->ret;
+    }
+    ++seen;
+    prev = addr;
+    fp = fp->next;
+  }
+  return count;
+}
+
+#else
+
+std::size_t capture_trace_impl(void **out, std::size_t max,
+                               std::size_t skip) noexcept {
+  return backtrace_capture(out, max, skip);
+}
+
+#endif // ERRORS_FRAME_POINTER_UNWIND
+
+std::size_t capture_trace(void **out, std::size_t max) noexcept {
+  std::size_t depth = g_max_depth.load(std::memory_order_relaxed);
+  if (depth < max) {
+    max = depth;
+  }
+  if (max == 0) {
+    return 0;
+  }
+#ifdef ERRORS_FRAME_POINTER_UNWIND
+  return capture_trace_impl(out, max, fp_skip_frames);
+#else
+  return capture_trace_impl(out, max, skip_frames);
+#endif
+}
+
+std::vector<frame> symbolize_trace(const void *const *ips,
+                                   std::size_t count) {
+  std::vector<frame> frames;
+  frames.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    frames.push_back(resolve_cached(ips[i]));
+  }
+  return frames;
+}
+
+} // namespace errors::detail
+
+namespace errors {
+
+std::size_t capture_raw(std::span<void *> out) noexcept {
+  // Bounded by the library's fixed capture buffer; no allocation, no
+  // locks (the unwinder is warmed at load).  Always the generic
+  // unwinder, even in the frame-pointer build: the fp walk cannot cross
+  // the kernel's signal frame, and signal handlers are this function's
+  // reason to exist.
+  std::size_t max = out.size() < detail::max_frames ? out.size()
+                                                    : detail::max_frames;
+  if (max == 0) {
+    return 0;
+  }
+  // Skip only the capture_raw frame itself; crash handlers want their
+  // own frames visible.
+  return detail::backtrace_capture(out.data(), max, 1);
+}
+
+void set_max_trace_depth(std::size_t depth) noexcept {
+  if (depth > detail::max_frames) {
+    depth = detail::max_frames;
+  }
+  detail::g_max_depth.store(depth, std::memory_order_relaxed);
+}
+
+std::size_t get_max_trace_depth() noexcept {
+  return detail::g_max_depth.load(std::memory_order_relaxed);
+}
+
+symbolizer_stats get_symbolizer_stats() noexcept {
+  symbolizer_stats stats;
+  stats.lookups = detail::g_lookups.load(std::memory_order_relaxed);
+  stats.hits = detail::g_hits.load(std::memory_order_relaxed);
+  stats.uncached = detail::g_uncached.load(std::memory_order_relaxed);
+  stats.numa_replicas = detail::topology().nodes;
+  return stats;
+}
+
+} // namespace errors
@@ -0,0 +1,18 @@
+#ifndef ERRORS_TESTS_CHECK_HPP
+#define ERRORS_TESTS_CHECK_HPP
+
+#include <cstdio>
+#include <cstdlib>
+
+// Minimal test support: CHECK aborts the test binary with a location on
+// failure; each test file is its own executable registered with CTest.
+#define CHECK(cond)                                                          \
+  do {                                                                       \
+    if (!(cond)) {                                                           \
+      std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__,  \
+                   #cond);                                                   \
+      std::abort();                                                          \
+    }                                                                        \
+  } while (0)
+
+#endif // ERRORS_TESTS_CHECK_HPP
@@ -0,0 +1,70 @@
+#include "errors/arena.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+void test_arena_chain() {
+  errors::arena a;
+  errors::error err = errors::new_error(a, "connection refused");
+  err = errors::wrap(a, std::move(err), "dial tcp 10.0.0.1:443");
+  err = errors::wrap(a, std::move(err), "fetch shard 7");
+  CHECK(std::strcmp(err.what(),
+                    "fetch shard 7: dial tcp 10.0.0.1:443: "
+                    "connection refused") == 0);
+  CHECK(err.cause().message() == "dial tcp 10.0.0.1:443");
+  CHECK(a.bytes_reserved() > 0);
+}
+
+void test_deep_chain_stays_in_few_blocks() {
+  errors::arena a;
+  errors::error err = errors::new_error(a, "root");
+  for (int i = 0; i < 10; ++i) {
+    err = errors::wrap(a, std::move(err), "level " + std::to_string(i));
+  }
+  // Ten levels of wrapping should fit in a small number of blocks, not
+  // one allocation per level.
+  CHECK(a.bytes_reserved() <= 4 * 4096);
+}
+
+void test_reset_releases_everything() {
+  errors::arena a;
+  {
+    errors::error err = errors::new_error(a, "scoped");
+    CHECK(err);
+  }
+  a.reset();
+  CHECK(a.bytes_reserved() == 0);
+  // The arena is reusable after reset.
+  errors::error err = errors::new_error(a, "again");
+  CHECK(err.message() == "again");
+}
+
+void test_mixed_heap_and_arena_chain() {
+  errors::arena a;
+  errors::error inner = errors::new_error("heap-backed");
+  errors::error err = errors::wrap(a, std::move(inner), "arena-backed");
+  CHECK(std::strcmp(err.what(), "arena-backed: heap-backed") == 0);
+}
+
+void test_oversized_allocation() {
+  errors::arena a(64);
+  errors::error err =
+      errors::new_error(a, std::string(1024, 'x'));
+  CHECK(err.message().size() == 1024);
+}
+
+} // namespace
+
+int main() {
+  test_arena_chain();
+  test_deep_chain_stays_in_few_blocks();
+  test_reset_releases_everything();
+  test_mixed_heap_and_arena_chain();
+  test_oversized_allocation();
+  return 0;
+}
@@ -0,0 +1,105 @@
+#include "errors/errors.hpp"
+
+#include "errors/serialize.hpp"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+void test_unlimited_by_default() {
+  CHECK(errors::get_memory_budget() == 0);
+  errors::error err = errors::new_error(std::string(200, 'm'));
+  CHECK(!err.trace().empty());
+  CHECK(err.message().size() == 200);
+}
+
+void test_degrades_under_pressure() {
+  // Small budget, then hold enough live errors to blow through it.
+  errors::set_memory_budget(256 * 1024);
+  std::vector<errors::error> held;
+  for (int i = 0; i < 1000; ++i) {
+    held.push_back(errors::new_error(std::string(300, 'x')));
+  }
+  errors::flush_memory_accounting();
+  CHECK(errors::approximate_memory_use() > 256 * 1024);
+
+  // Hard pressure: no trace, message truncated to the in-node buffer.
+  errors::error degraded = errors::new_error(std::string(300, 'y'));
+  CHECK(degraded.trace().empty());
+  CHECK(degraded.message().size() < 300);
+
+  // Releasing the storm restores full-fidelity errors.
+  held.clear();
+  errors::flush_memory_accounting();
+  errors::error recovered = errors::new_error(std::string(300, 'z'));
+  errors::set_memory_budget(0);
+  CHECK(!recovered.trace().empty());
+  CHECK(recovered.message().size() == 300);
+}
+
+void test_accounting_tracks_lifetime() {
+  errors::flush_memory_accounting();
+  std::size_t before = errors::approximate_memory_use();
+  {
+    std::vector<errors::error> held;
+    for (int i = 0; i < 200; ++i) {
+      held.push_back(errors::new_error(std::string(100, 'a')));
+    }
+    errors::flush_memory_accounting();
+    CHECK(errors::approximate_memory_use() > before);
+  }
+  errors::flush_memory_accounting();
+  // Everything released: usage returns to the baseline.
+  CHECK(errors::approximate_memory_use() <= before + 1024);
+}
+
+void test_wire_nodes_are_accounted() {
+  // Deserialized nodes must debit the governor like any other creation;
+  // destroy() credits them unconditionally, and an unmatched credit
+  // drives the counter negative and disables budget degradation in
+  // proxy tiers that revive errors off the wire.
+  errors::error held_base = errors::new_error(std::string(100, 'b'));
+  std::string wire = errors::serialize(errors::new_error("wire node"));
+  errors::flush_memory_accounting();
+  std::size_t before = errors::approximate_memory_use();
+  CHECK(before > 0);
+  {
+    std::vector<errors::error> held;
+    for (int i = 0; i < 200; ++i) {
+      errors::error decoded;
+      CHECK(!errors::deserialize(wire, decoded));
+      held.push_back(std::move(decoded));
+    }
+    errors::flush_memory_accounting();
+    CHECK(errors::approximate_memory_use() > before);
+  }
+  errors::flush_memory_accounting();
+  // Symmetric lifetime: back to the baseline, not below it.
+  CHECK(errors::approximate_memory_use() <= before + 1024);
+  CHECK(errors::approximate_memory_use() + 1024 >= before);
+}
+
+void test_short_messages_survive_truncation_mode() {
+  errors::error held = errors::new_error(std::string("hold"));
+  errors::flush_memory_accounting();
+  errors::set_memory_budget(1); // anything live is over budget
+  errors::error err = errors::new_error(std::string("short"));
+  errors::set_memory_budget(0);
+  CHECK(err.message() == "short"); // fits the in-node buffer untouched
+  CHECK(err.trace().empty());
+}
+
+} // namespace
+
+int main() {
+  test_unlimited_by_default();
+  test_degrades_under_pressure();
+  test_accounting_tracks_lifetime();
+  test_wire_nodes_are_accounted();
+  test_short_messages_survive_truncation_mode();
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "errors/errors.hpp"
+
+#include <string>
+#include <utility>
+
+#include "errors/serialize.hpp"
+#include "check.hpp"
+
+namespace {
+
+inline constexpr auto cat_timeout = errors::category{1u << 0};
+inline constexpr auto cat_retryable = errors::category{1u << 1};
+inline constexpr auto cat_auth = errors::category{1u << 2};
+
+inline constexpr errors::static_error kErrTimeout{"timeout",
+                                                  cat_timeout | cat_retryable};
+
+void test_tag_and_query() {
+  errors::error err =
+      errors::with_category(errors::new_error("deadline"), cat_timeout);
+  CHECK(errors::has_category(err, cat_timeout));
+  CHECK(!errors::has_category(err, cat_auth));
+  CHECK(errors::categories(err) == cat_timeout);
+}
+
+void test_accumulation_at_wrap() {
+  errors::error err =
+      errors::with_category(errors::new_error("deadline"), cat_timeout);
+  err = errors::wrap(std::move(err), "shard 3");
+  err = errors::with_category(std::move(err), cat_retryable);
+  err = errors::wrap(std::move(err), "request 9f2");
+  // The outermost node answers for the whole chain.
+  CHECK(errors::has_category(err, cat_timeout));
+  CHECK(errors::has_category(err, cat_retryable));
+  CHECK(errors::has_category(err, cat_timeout | cat_auth));
+  CHECK(!errors::has_category(err, cat_auth));
+}
+
+void test_sentinel_categories() {
+  CHECK(errors::has_category(errors::error(kErrTimeout), cat_timeout));
+  errors::error err = errors::wrap(errors::error(kErrTimeout), "rpc");
+  CHECK(errors::has_category(err, cat_retryable));
+  CHECK(errors::is(err, kErrTimeout));
+}
+
+void test_tagging_a_bare_sentinel() {
+  errors::error err =
+      errors::with_category(errors::error(kErrTimeout), cat_auth);
+  CHECK(errors::has_category(err, cat_auth));
+  CHECK(errors::has_category(err, cat_timeout));
+  CHECK(errors::is(err, kErrTimeout));
+  // The tagging node is invisible in the rendering.
+  CHECK(std::string(err.what()) == "timeout");
+}
+
+void test_categories_cross_the_wire() {
+  errors::error err =
+      errors::with_category(errors::new_error("deadline"), cat_timeout);
+  std::string wire = errors::serialize(err);
+  errors::error decoded;
+  CHECK(!errors::deserialize(wire, decoded));
+  CHECK(errors::has_category(decoded, cat_timeout));
+}
+
+void test_empty_error_has_no_categories() {
+  CHECK(errors::categories(errors::error()) == errors::category::none);
+  CHECK(!errors::has_category(errors::error(), cat_timeout));
+}
+
+} // namespace
+
+int main() {
+  test_tag_and_query();
+  test_accumulation_at_wrap();
+  test_sentinel_categories();
+  test_tagging_a_bare_sentinel();
+  test_categories_cross_the_wire();
+  test_empty_error_has_no_categories();
+  return 0;
+}
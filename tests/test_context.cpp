@@ -0,0 +1,91 @@
+#include "errors/context.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "errors/arena.hpp"
+#include "check.hpp"
+
+namespace {
+
+void test_typed_pairs() {
+  errors::error err = errors::new_error("lookup failed");
+  err = errors::with_context(std::move(err), "shard", std::int64_t{42});
+  err = errors::with_context(std::move(err), "user", std::string_view("u-9"));
+  err = errors::with_context(std::move(err), "retryable", true);
+
+  std::span<const errors::context_pair> pairs = errors::context(err);
+  CHECK(pairs.size() == 3);
+  CHECK(pairs[0].key == "shard");
+  CHECK(pairs[0].value.type() == errors::context_value::kind::i64);
+  CHECK(pairs[0].value.as_int64() == 42);
+  CHECK(pairs[1].key == "user");
+  CHECK(pairs[1].value.as_string() == "u-9");
+  CHECK(pairs[2].value.type() == errors::context_value::kind::boolean);
+  CHECK(pairs[2].value.as_bool());
+}
+
+void test_context_does_not_touch_message() {
+  errors::error err = errors::new_error("plain");
+  err = errors::with_context(std::move(err), "rq", std::int64_t{7});
+  CHECK(std::string(err.what()) == "plain");
+}
+
+void test_spill_past_inline_capacity() {
+  errors::error err = errors::new_error("busy");
+  for (std::int64_t i = 0; i < 10; ++i) {
+    err = errors::with_context(std::move(err), "n", i);
+  }
+  std::span<const errors::context_pair> pairs = errors::context(err);
+  CHECK(pairs.size() == 10);
+  for (std::int64_t i = 0; i < 10; ++i) {
+    CHECK(pairs[static_cast<std::size_t>(i)].value.as_int64() == i);
+  }
+}
+
+void test_spill_into_arena() {
+  errors::arena a;
+  errors::error err = errors::new_error(a, "arena-backed");
+  for (std::int64_t i = 0; i < 8; ++i) {
+    err = errors::with_context(std::move(err), "k", i);
+  }
+  CHECK(errors::context(err).size() == 8);
+}
+
+void test_context_is_per_node() {
+  errors::error inner = errors::new_error("inner");
+  inner = errors::with_context(std::move(inner), "depth", std::int64_t{1});
+  errors::error outer = errors::wrap(std::move(inner), "outer");
+  CHECK(errors::context(outer).empty());
+  CHECK(errors::context(outer.cause()).size() == 1);
+}
+
+void test_context_on_sentinel() {
+  static constexpr errors::static_error ERR_BUSY{"busy"};
+  errors::error err =
+      errors::with_context(errors::error(ERR_BUSY), "port", std::int64_t{443});
+  CHECK(errors::context(err).size() == 1);
+  CHECK(errors::is(err, ERR_BUSY));
+  CHECK(std::string(err.what()) == "busy");
+}
+
+void test_empty_error() {
+  errors::error err;
+  err = errors::with_context(std::move(err), "k", std::int64_t{1});
+  CHECK(!err);
+  CHECK(errors::context(err).empty());
+}
+
+} // namespace
+
+int main() {
+  test_typed_pairs();
+  test_context_does_not_touch_message();
+  test_spill_past_inline_capacity();
+  test_spill_into_arena();
+  test_context_is_per_node();
+  test_context_on_sentinel();
+  test_empty_error();
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include "errors/errors.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+void test_empty_error() {
+  errors::error err;
+  CHECK(!err);
+  CHECK(std::strcmp(err.what(), "") == 0);
+  CHECK(err.message().empty());
+  CHECK(!err.cause());
+}
+
+void test_new_error() {
+  errors::error err = errors::new_error("connection refused");
+  CHECK(err);
+  CHECK(err.message() == "connection refused");
+  CHECK(std::strcmp(err.what(), "connection refused") == 0);
+  CHECK(!err.cause());
+}
+
+void test_wrap_chain() {
+  errors::error err = errors::new_error("connection refused");
+  err = errors::wrap(std::move(err), "dial tcp 10.0.0.1:443");
+  err = errors::wrap(std::move(err), "fetch shard 7");
+  CHECK(err.message() == "fetch shard 7");
+  CHECK(std::strcmp(err.what(),
+                    "fetch shard 7: dial tcp 10.0.0.1:443: "
+                    "connection refused") == 0);
+  errors::error inner = err.cause();
+  CHECK(inner.message() == "dial tcp 10.0.0.1:443");
+  CHECK(inner.cause().message() == "connection refused");
+}
+
+void test_wrap_empty_is_new_error() {
+  errors::error err = errors::wrap(errors::error(), "top");
+  CHECK(err);
+  CHECK(std::strcmp(err.what(), "top") == 0);
+  CHECK(!err.cause());
+}
+
+void test_move_semantics() {
+  errors::error a = errors::new_error("boom");
+  errors::error b = std::move(a);
+  CHECK(!a);
+  CHECK(b);
+  CHECK(b.message() == "boom");
+}
+
+void test_is_identity() {
+  errors::error target = errors::new_error("sentinel");
+  // cause() views share node identity with the owner.
+  errors::error other = errors::new_error("sentinel");
+  CHECK(errors::is(target, target));
+  CHECK(!errors::is(other, target));
+  CHECK(errors::is(errors::error(), errors::error()));
+  CHECK(!errors::is(errors::error(), target));
+}
+
+} // namespace
+
+int main() {
+  test_empty_error();
+  test_new_error();
+  test_wrap_chain();
+  test_wrap_empty_is_new_error();
+  test_move_semantics();
+  test_is_identity();
+  return 0;
+}
@@ -0,0 +1,125 @@
+#include "errors/dedup.hpp"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+struct recording_sink : errors::report_sink {
+  struct emission {
+    std::string message;
+    std::uint64_t occurrences;
+  };
+  std::vector<emission> emissions;
+
+  void on_report(const errors::error &representative,
+                 std::uint64_t occurrences) override {
+    emissions.push_back({std::string(representative.message()), occurrences});
+  }
+};
+
+// Creation sites matter: the dedup key is (capture site, message), so
+// these helpers pin one site per message regardless of which test line
+// asks for the error.
+[[gnu::noinline]] errors::error make_transient() {
+  return errors::new_error(std::string("transient"));
+}
+
+[[gnu::noinline]] errors::error make_timeout() {
+  return errors::new_error(std::string("timeout"));
+}
+
+void test_first_occurrence_emits() {
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink);
+  reporter.report(errors::new_error("disk full"));
+  CHECK(sink.emissions.size() == 1);
+  CHECK(sink.emissions[0].message == "disk full");
+  CHECK(sink.emissions[0].occurrences == 1);
+}
+
+void test_duplicates_are_aggregated() {
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink, std::chrono::milliseconds(10000));
+  for (int i = 0; i < 1000; ++i) {
+    reporter.report(errors::new_error(std::string("flood")));
+  }
+  // One emission for the first arrival; the rest sit in the window.
+  CHECK(sink.emissions.size() == 1);
+  CHECK(reporter.suppressed() == 999);
+
+  reporter.flush();
+  CHECK(sink.emissions.size() == 2);
+  CHECK(sink.emissions[1].message == "flood");
+  CHECK(sink.emissions[1].occurrences == 999);
+}
+
+void test_window_expiry_emits_count() {
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink, std::chrono::milliseconds(20));
+  for (int i = 0; i < 50; ++i) {
+    reporter.report(make_transient());
+  }
+  CHECK(sink.emissions.size() == 1);
+  std::this_thread::sleep_for(std::chrono::milliseconds(30));
+  // First report after the deadline carries the aggregate.
+  reporter.report(make_transient());
+  CHECK(sink.emissions.size() == 2);
+  CHECK(sink.emissions[1].occurrences == 50);
+}
+
+void test_distinct_messages_are_distinct_keys() {
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink, std::chrono::milliseconds(10000));
+  reporter.report(make_timeout());
+  reporter.report(errors::new_error(std::string("refused")));
+  reporter.report(make_timeout());
+  CHECK(sink.emissions.size() == 2);
+  CHECK(reporter.suppressed() == 1);
+}
+
+void test_destructor_flushes() {
+  recording_sink sink;
+  {
+    errors::dedup_reporter reporter(sink, std::chrono::milliseconds(10000));
+    reporter.report(errors::new_error(std::string("pending")));
+    reporter.report(errors::new_error(std::string("pending")));
+  }
+  CHECK(sink.emissions.size() == 2);
+  CHECK(sink.emissions[1].occurrences == 1);
+}
+
+void test_empty_error_is_ignored() {
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink);
+  reporter.report(errors::error());
+  CHECK(sink.emissions.empty());
+}
+
+void test_sentinels_dedup_by_identity() {
+  static constexpr errors::static_error ERR_THROTTLED{"throttled"};
+  recording_sink sink;
+  errors::dedup_reporter reporter(sink, std::chrono::milliseconds(10000));
+  reporter.report(errors::error(ERR_THROTTLED));
+  reporter.report(errors::error(ERR_THROTTLED));
+  CHECK(sink.emissions.size() == 1);
+  CHECK(reporter.suppressed() == 1);
+}
+
+} // namespace
+
+int main() {
+  test_first_occurrence_emits();
+  test_duplicates_are_aggregated();
+  test_window_expiry_emits_count();
+  test_distinct_messages_are_distinct_keys();
+  test_destructor_flushes();
+  test_empty_error_is_ignored();
+  test_sentinels_dedup_by_identity();
+  return 0;
+}
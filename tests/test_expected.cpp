@@ -0,0 +1,106 @@
+#include "errors/expected.hpp"
+
+#include <coroutine>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+void test_value_path() {
+  errors::expected<int> r(42);
+  CHECK(r.has_value());
+  CHECK(*r == 42);
+}
+
+void test_error_path() {
+  errors::expected<int> r(errors::new_error("nope"));
+  CHECK(!r);
+  CHECK(r.err().message() == "nope");
+  errors::error err = std::move(r).take_error();
+  CHECK(err.message() == "nope");
+}
+
+void test_sentinel_path() {
+  static constexpr errors::static_error ERR_EOF{"eof"};
+  errors::expected<std::string> r(ERR_EOF);
+  CHECK(!r);
+  CHECK(errors::is(r.err(), ERR_EOF));
+}
+
+void test_move_through_layers() {
+  errors::expected<int> r(errors::wrap(errors::new_error("inner"), "outer"));
+  // Twenty hand-offs, as across coroutine frames: each is a payload move
+  // plus a one-word error move, never a chain copy.
+  for (int i = 0; i < 20; ++i) {
+    errors::expected<int> next = std::move(r);
+    r = std::move(next);
+  }
+  CHECK(std::string(r.err().what()) == "outer: inner");
+}
+
+void test_void_specialization() {
+  errors::expected<void> ok;
+  CHECK(ok.has_value());
+  errors::expected<void> bad(errors::new_error("down"));
+  CHECK(!bad);
+  CHECK(std::move(bad).take_error().message() == "down");
+}
+
+// A minimal coroutine task, just enough to show errors::expected
+// crossing co_return/await boundaries by move.
+struct task {
+  struct promise_type {
+    errors::expected<int> result{0};
+
+    task get_return_object() {
+      return {std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_value(errors::expected<int> r) { result = std::move(r); }
+    void unhandled_exception() {}
+  };
+
+  std::coroutine_handle<promise_type> handle;
+
+  ~task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  errors::expected<int> take() { return std::move(handle.promise().result); }
+};
+
+task failing_coroutine(int depth) {
+  if (depth == 0) {
+    co_return errors::new_error("bottom");
+  }
+  task inner = failing_coroutine(depth - 1);
+  errors::expected<int> r = inner.take();
+  if (!r) {
+    co_return errors::wrap(std::move(r).take_error(), "level");
+  }
+  co_return *r + 1;
+}
+
+void test_coroutine_propagation() {
+  task t = failing_coroutine(3);
+  errors::expected<int> r = t.take();
+  CHECK(!r);
+  CHECK(std::string(r.err().what()) == "level: level: level: bottom");
+}
+
+} // namespace
+
+int main() {
+  test_value_path();
+  test_error_path();
+  test_sentinel_path();
+  test_move_through_layers();
+  test_void_specialization();
+  test_coroutine_propagation();
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include "errors/flight.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "errors/intern.hpp"
+#include "check.hpp"
+
+namespace {
+
+constexpr auto cat_retryable = errors::category{1u << 1};
+
+void test_disabled_records_nothing() {
+  errors::error err = errors::new_error("unrecorded");
+  CHECK(errors::flight_snapshot().empty());
+}
+
+void test_records_creations() {
+  errors::enable_flight_recorder(64);
+  std::size_t before = errors::flight_snapshot().size();
+  for (int i = 0; i < 5; ++i) {
+    errors::error err = errors::new_error("incident");
+  }
+  std::vector<errors::flight_record> snap = errors::flight_snapshot();
+  errors::disable_flight_recorder();
+  CHECK(snap.size() == before + 5);
+  CHECK(snap.back().site != nullptr);
+  CHECK(std::is_sorted(snap.begin(), snap.end(),
+                       [](const errors::flight_record &a,
+                          const errors::flight_record &b) {
+                         return a.timestamp_ns < b.timestamp_ns;
+                       }));
+}
+
+void test_wrap_and_categories_recorded() {
+  errors::enable_flight_recorder(64);
+  errors::error err = errors::with_category(errors::new_error("busy"),
+                                            cat_retryable);
+  errors::error wrapped = errors::wrap(std::move(err), "acquire");
+  std::vector<errors::flight_record> snap = errors::flight_snapshot();
+  errors::disable_flight_recorder();
+  // The wrapping node inherits its cause's categories at creation.
+  CHECK(snap.back().categories ==
+        static_cast<std::uint64_t>(cat_retryable));
+}
+
+void test_ring_is_bounded() {
+  errors::enable_flight_recorder(64);
+  for (int i = 0; i < 200; ++i) {
+    errors::error err = errors::new_error("flood");
+  }
+  std::size_t after = errors::flight_snapshot().size();
+  errors::disable_flight_recorder();
+  // This thread's ring holds 64 entries: the flood overwrote older
+  // records instead of accumulating.
+  CHECK(after <= 64);
+}
+
+void test_intern_id_in_digest() {
+  errors::set_message_interning(true);
+  errors::enable_flight_recorder(64);
+  errors::error err = errors::new_error(std::string("interned flight"));
+  std::uint32_t id = errors::message_id(err);
+  std::vector<errors::flight_record> snap = errors::flight_snapshot();
+  errors::disable_flight_recorder();
+  errors::set_message_interning(false);
+  CHECK(id != 0);
+  CHECK(snap.back().intern_id == id);
+  CHECK(errors::interned_message(snap.back().intern_id) == "interned flight");
+}
+
+void test_stitches_across_threads() {
+  errors::enable_flight_recorder(64);
+  std::uint32_t main_thread = 0;
+  {
+    errors::error err = errors::new_error("main side");
+    main_thread = errors::flight_snapshot().back().thread;
+  }
+  std::thread worker([] {
+    for (int i = 0; i < 3; ++i) {
+      errors::error err = errors::new_error("worker side");
+    }
+  });
+  worker.join();
+  // The worker has exited; its ring was retired but the records remain.
+  std::vector<errors::flight_record> snap = errors::flight_snapshot();
+  errors::disable_flight_recorder();
+  std::size_t other = 0;
+  for (const errors::flight_record &r : snap) {
+    if (r.thread != main_thread) {
+      ++other;
+    }
+  }
+  CHECK(other >= 3);
+}
+
+} // namespace
+
+int main() {
+  test_disabled_records_nothing();
+  test_records_creations();
+  test_wrap_and_categories_recorded();
+  test_ring_is_bounded();
+  test_intern_id_in_digest();
+  test_stitches_across_threads();
+  return 0;
+}
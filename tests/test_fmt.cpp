@@ -0,0 +1,96 @@
+#include "errors/fmt.hpp"
+
+#include "errors/arena.hpp"
+
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+void test_basic_substitution() {
+  errors::error err =
+      errors::wrap_fmt(errors::new_error("timeout"), "shard {} failed", 17);
+  CHECK(err.message() == "shard 17 failed");
+  CHECK(std::string(err.what()) == "shard 17 failed: timeout");
+}
+
+void test_argument_kinds() {
+  errors::error err = errors::wrap_fmt(
+      errors::new_error("inner"), "host={} port={} tls={} grade={} load={}",
+      std::string_view("db-3"), 5432, true, 'A', 0.5);
+  CHECK(err.message() == "host=db-3 port=5432 tls=true grade=A load=0.5");
+}
+
+void test_string_argument_is_copied() {
+  std::string transient = "gone-by-render-time";
+  errors::error err =
+      errors::wrap_fmt(errors::new_error("inner"), "key {}", transient);
+  transient.assign(transient.size(), '#');
+  CHECK(err.message() == "key gone-by-render-time");
+}
+
+void test_brace_escapes() {
+  errors::error err =
+      errors::wrap_fmt(errors::new_error("inner"), "json {{\"id\": {}}}", 7);
+  CHECK(err.message() == "json {\"id\": 7}");
+}
+
+void test_no_placeholders() {
+  errors::error err =
+      errors::wrap_fmt(errors::new_error("inner"), "plain message");
+  CHECK(err.message() == "plain message");
+}
+
+void test_long_message_spills() {
+  std::string big(500, 'q');
+  errors::error err =
+      errors::wrap_fmt(errors::new_error("inner"), "blob: {}", big);
+  CHECK(err.message() == "blob: " + big);
+}
+
+void test_wrap_empty_acts_as_leaf() {
+  errors::error err = errors::wrap_fmt(errors::error(), "attempt {}", 3);
+  CHECK(err.message() == "attempt 3");
+  CHECK(!err.cause());
+}
+
+void test_sentinel_cause_preserved() {
+  static constexpr errors::static_error ERR_FULL{"disk full"};
+  errors::error err =
+      errors::wrap_fmt(errors::error(ERR_FULL), "write block {}", 42);
+  CHECK(std::string(err.what()) == "write block 42: disk full");
+  CHECK(errors::is(err, ERR_FULL));
+}
+
+void test_origin_is_the_call_site() {
+  errors::error err = errors::wrap_fmt(errors::error(), "here"); // line 69
+  CHECK(err.origin().line() == 69);
+}
+
+void test_arena_variant() {
+  errors::arena a(4096);
+  std::string big(200, 'w');
+  errors::error err =
+      errors::wrap_fmt(a, errors::new_error(a, "inner"), "big: {}", big);
+  CHECK(err.message() == "big: " + big);
+  CHECK(std::string(err.what()) == "big: " + big + ": inner");
+}
+
+} // namespace
+
+int main() {
+  test_basic_substitution();
+  test_argument_kinds();
+  test_string_argument_is_copied();
+  test_brace_escapes();
+  test_no_placeholders();
+  test_long_message_spills();
+  test_wrap_empty_acts_as_leaf();
+  test_sentinel_cause_preserved();
+  test_origin_is_the_call_site();
+  test_arena_variant();
+  return 0;
+}
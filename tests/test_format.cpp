@@ -0,0 +1,76 @@
+#include "errors/format.hpp"
+
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+errors::error make_chain() {
+  errors::error err = errors::new_error("connection refused");
+  err = errors::wrap(std::move(err), "dial tcp 10.0.0.1:443");
+  err = errors::wrap(std::move(err), "fetch shard 7");
+  return err;
+}
+
+constexpr char kExpected[] =
+    "fetch shard 7: dial tcp 10.0.0.1:443: connection refused";
+
+void test_rendered_size_is_exact() {
+  errors::error err = make_chain();
+  CHECK(errors::rendered_size(err) == std::strlen(kExpected));
+  CHECK(errors::rendered_size(errors::error()) == 0);
+}
+
+void test_format_to_buffer() {
+  errors::error err = make_chain();
+  std::array<char, 256> buffer;
+  std::size_t n = errors::format_to(err, buffer);
+  CHECK(n == std::strlen(kExpected));
+  CHECK(std::memcmp(buffer.data(), kExpected, n) == 0);
+}
+
+void test_format_to_small_buffer_truncates() {
+  errors::error err = make_chain();
+  std::array<char, 10> buffer;
+  std::size_t n = errors::format_to(err, buffer);
+  CHECK(n == 10);
+  CHECK(std::memcmp(buffer.data(), kExpected, n) == 0);
+}
+
+void test_format_append_reserves_once() {
+  errors::error err = make_chain();
+  std::string out = "error: ";
+  errors::format_append(err, out);
+  CHECK(out == std::string("error: ") + kExpected);
+}
+
+void test_output_iterator() {
+  errors::error err = make_chain();
+  std::string out;
+  errors::format_to(err, std::back_inserter(out));
+  CHECK(out == kExpected);
+}
+
+void test_matches_what() {
+  errors::error err = make_chain();
+  std::string streamed;
+  errors::format_append(err, streamed);
+  CHECK(streamed == err.what());
+}
+
+} // namespace
+
+int main() {
+  test_rendered_size_is_exact();
+  test_format_to_buffer();
+  test_format_to_small_buffer_truncates();
+  test_format_append_reserves_once();
+  test_output_iterator();
+  test_matches_what();
+  return 0;
+}
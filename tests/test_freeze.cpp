@@ -0,0 +1,147 @@
+#include "errors/freeze.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+void test_flatten_chain() {
+  errors::error err = errors::wrap(errors::new_error("inner"), "outer");
+  errors::frozen_error frozen = errors::freeze(err);
+  CHECK(frozen.depth() == 2);
+  CHECK(frozen.message(0) == "outer");
+  CHECK(frozen.message(1) == "inner");
+  CHECK(frozen.to_string() == "outer: inner");
+  // The live error is untouched.
+  CHECK(std::string(err.what()) == "outer: inner");
+}
+
+void test_trace_is_frozen_raw() {
+  errors::error err = errors::new_error("traced");
+  errors::frozen_error frozen = errors::freeze(err);
+  CHECK(!frozen.trace(0).empty());
+  CHECK(frozen.trace(0).size() == err.trace().size());
+  CHECK(frozen.trace(0)[0] ==
+        reinterpret_cast<std::uint64_t>(err.trace()[0].ip));
+}
+
+void test_context_and_categories_survive() {
+  constexpr auto cat_retryable = errors::category{1u << 1};
+  errors::error err = errors::new_error("busy");
+  err = errors::with_category(std::move(err), cat_retryable);
+  err = errors::with_context(std::move(err), "shard", std::int64_t{9});
+  err = errors::with_context(std::move(err), "user", std::string_view("u-4"));
+  err = errors::with_context(std::move(err), "retry", true);
+
+  errors::frozen_error frozen = errors::freeze(err);
+  CHECK(any(frozen.categories() & cat_retryable));
+  CHECK(frozen.context_count(0) == 3);
+  errors::context_pair p0 = frozen.context(0, 0);
+  CHECK(p0.key == "shard");
+  CHECK(p0.value.as_int64() == 9);
+  errors::context_pair p1 = frozen.context(0, 1);
+  CHECK(p1.value.as_string() == "u-4");
+  errors::context_pair p2 = frozen.context(0, 2);
+  CHECK(p2.value.as_bool());
+}
+
+void test_sentinel_tail_is_a_level() {
+  static constexpr errors::static_error ERR_FULL{"disk full"};
+  errors::error err = errors::wrap(errors::error(ERR_FULL), "write");
+  errors::frozen_error frozen = errors::freeze(err);
+  CHECK(frozen.depth() == 2);
+  CHECK(frozen.message(1) == "disk full");
+  CHECK(frozen.to_string() == "write: disk full");
+}
+
+void test_freeze_tagged_shared_error() {
+  constexpr auto cat_retryable = errors::category{1u << 1};
+  // Tagging a shared error creates a copy-on-write head whose message
+  // is an empty view; freezing that chain must cope with it.
+  errors::error base = errors::new_error("flaky upstream");
+  errors::error shared = base.share();
+  errors::error tagged =
+      errors::with_category(std::move(shared), cat_retryable);
+  errors::frozen_error frozen = errors::freeze(tagged);
+  CHECK(frozen.depth() == 2);
+  CHECK(frozen.message(0).empty());
+  CHECK(frozen.to_string() == "flaky upstream");
+  CHECK(any(frozen.categories() & cat_retryable));
+}
+
+void test_round_trip_through_bytes() {
+  errors::error err = errors::wrap(errors::new_error("inner"), "outer");
+  err = errors::with_context(std::move(err), "attempt", std::int64_t{3});
+  errors::frozen_error frozen = errors::freeze(err);
+
+  // The retry-log pattern: persist the bytes, revive later.
+  std::span<const std::byte> raw = frozen.bytes();
+  std::vector<std::byte> stored(raw.begin(), raw.end());
+  errors::frozen_error revived =
+      errors::frozen_error::from_bytes(std::span<const std::byte>(stored));
+  CHECK(revived.depth() == frozen.depth());
+  CHECK(revived.to_string() == "outer: inner");
+  CHECK(revived.context(0, 0).value.as_int64() == 3);
+}
+
+void test_bad_bytes_are_rejected() {
+  CHECK(!errors::frozen_error::from_bytes({}));
+  std::vector<std::byte> junk(64, std::byte{0x5A});
+  CHECK(!errors::frozen_error::from_bytes(std::span<const std::byte>(junk)));
+}
+
+void test_corrupt_offsets_are_rejected() {
+  errors::error err = errors::new_error("inner");
+  err = errors::with_context(std::move(err), "shard", std::int64_t{9});
+  errors::frozen_error frozen = errors::freeze(err);
+  std::span<const std::byte> raw = frozen.bytes();
+
+  // Blast every 32-bit word of the record to a huge value in turn; no
+  // out-of-range offset or count may survive validation.
+  for (std::size_t off = 0; off + 4 <= raw.size(); off += 4) {
+    std::vector<std::byte> mutated(raw.begin(), raw.end());
+    const std::uint32_t poison = 0xFFFF0000u;
+    std::memcpy(mutated.data() + off, &poison, sizeof(poison));
+    errors::frozen_error revived =
+        errors::frozen_error::from_bytes(std::span<const std::byte>(mutated));
+    if (!revived) {
+      continue; // rejected: fine
+    }
+    // Accepted: reading everything back must stay inside the buffer
+    // (under ASan this is what catches a missed bound).
+    for (std::size_t l = 0; l < revived.depth(); ++l) {
+      (void)revived.message(l);
+      (void)revived.trace(l);
+      for (std::size_t c = 0; c < revived.context_count(l); ++c) {
+        (void)revived.context(l, c);
+      }
+    }
+  }
+}
+
+void test_freeze_empty() {
+  errors::frozen_error frozen = errors::freeze(errors::error());
+  CHECK(!frozen);
+  CHECK(frozen.depth() == 0);
+  CHECK(frozen.to_string().empty());
+}
+
+} // namespace
+
+int main() {
+  test_flatten_chain();
+  test_trace_is_frozen_raw();
+  test_context_and_categories_survive();
+  test_sentinel_tail_is_a_level();
+  test_freeze_tagged_shared_error();
+  test_round_trip_through_bytes();
+  test_bad_bytes_are_rejected();
+  test_corrupt_offsets_are_rejected();
+  test_freeze_empty();
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "errors/intern.hpp"
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+void test_disabled_by_default() {
+  CHECK(!errors::message_interning_enabled());
+  errors::error err = errors::new_error("not interned");
+  CHECK(errors::message_id(err) == 0);
+}
+
+void test_interned_round_trip() {
+  errors::set_message_interning(true);
+  errors::error a = errors::new_error(std::string("disk quota exceeded"));
+  errors::error b = errors::new_error(std::string("disk quota exceeded"));
+  errors::error c = errors::new_error(std::string("permission denied"));
+  errors::set_message_interning(false);
+
+  std::uint32_t ida = errors::message_id(a);
+  CHECK(ida != 0);
+  // Same message, same ID: equality is an integer compare.
+  CHECK(errors::message_id(b) == ida);
+  CHECK(errors::message_id(c) != 0);
+  CHECK(errors::message_id(c) != ida);
+
+  CHECK(a.message() == "disk quota exceeded");
+  CHECK(errors::interned_message(ida) == "disk quota exceeded");
+}
+
+void test_interned_messages_render() {
+  errors::set_message_interning(true);
+  errors::error err = errors::new_error(std::string("inner interned"));
+  err = errors::wrap(std::move(err), std::string("outer interned"));
+  errors::set_message_interning(false);
+  CHECK(std::string(err.what()) == "outer interned: inner interned");
+}
+
+void test_unknown_id_is_empty() {
+  CHECK(errors::interned_message(0).empty());
+  CHECK(errors::interned_message(0xFFFFFFFF).empty());
+}
+
+void test_concurrent_interning_agrees() {
+  errors::set_message_interning(true);
+  constexpr int threads = 8;
+  std::vector<std::uint32_t> ids(threads, 0);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([t, &ids] {
+      errors::error err =
+          errors::new_error(std::string("racing interned message"));
+      ids[t] = errors::message_id(err);
+    });
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  errors::set_message_interning(false);
+  CHECK(ids[0] != 0);
+  for (int t = 1; t < threads; ++t) {
+    CHECK(ids[t] == ids[0]);
+  }
+}
+
+} // namespace
+
+int main() {
+  test_disabled_by_default();
+  test_interned_round_trip();
+  test_interned_messages_render();
+  test_unknown_id_is_empty();
+  test_concurrent_interning_agrees();
+  return 0;
+}
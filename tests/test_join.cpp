@@ -0,0 +1,76 @@
+#include "errors/join.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+void test_empty_join() {
+  errors::join j;
+  CHECK(j.empty());
+  CHECK(!j.collapse());
+}
+
+void test_single_error_collapses_to_itself() {
+  errors::join j;
+  j.add(errors::new_error("only failure"));
+  errors::error err = j.collapse();
+  CHECK(std::strcmp(err.what(), "only failure") == 0);
+  CHECK(j.empty());
+}
+
+void test_arrival_order_and_rendering() {
+  errors::join j;
+  j.add(errors::new_error("shard 1 failed"));
+  j.add(errors::error());  // ignored
+  j.add(errors::new_error("shard 2 failed"));
+  CHECK(j.size() == 2);
+  errors::error err = j.collapse();
+  CHECK(std::strcmp(err.what(), "shard 1 failed; shard 2 failed") == 0);
+}
+
+void test_take_all_preserves_structure() {
+  errors::join j;
+  j.add(errors::wrap(errors::new_error("inner"), "outer"));
+  j.add(errors::new_error("other"));
+  std::vector<errors::error> all = j.take_all();
+  CHECK(all.size() == 2);
+  CHECK(std::strcmp(all[0].what(), "outer: inner") == 0);
+  CHECK(all[1].message() == "other");
+}
+
+void test_concurrent_producers() {
+  errors::join j;
+  constexpr int threads = 8;
+  constexpr int per_thread = 1000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&j, t] {
+      for (int i = 0; i < per_thread; ++i) {
+        j.add(errors::new_error("shard " + std::to_string(t)));
+      }
+    });
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  CHECK(j.size() == threads * per_thread);
+  std::vector<errors::error> all = j.take_all();
+  CHECK(all.size() == threads * per_thread);
+}
+
+} // namespace
+
+int main() {
+  test_empty_join();
+  test_single_error_collapses_to_itself();
+  test_arrival_order_and_rendering();
+  test_take_all_preserves_structure();
+  test_concurrent_producers();
+  return 0;
+}
@@ -0,0 +1,88 @@
+#include "errors/json.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "errors/context.hpp"
+#include "check.hpp"
+
+namespace {
+
+bool contains(const std::string &haystack, const std::string &needle) {
+  return haystack.find(needle) != std::string::npos;
+}
+
+void test_basic_shape() {
+  errors::error err = errors::wrap(errors::new_error("inner"), "outer");
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, "\"message\":\"outer: inner\""));
+  CHECK(contains(json, "\"chain\":[\"outer\",\"inner\"]"));
+  CHECK(contains(json, "\"origin\":{\"file\":"));
+  CHECK(json.front() == '{' && json.back() == '}');
+}
+
+void test_escaping() {
+  errors::error err = errors::new_error(std::string("say \"hi\"\n\tback\\"));
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, "say \\\"hi\\\"\\n\\tback\\\\"));
+}
+
+void test_control_bytes_and_utf8() {
+  // 0x01 needs a \u escape; multi-byte UTF-8 must pass through verbatim
+  // (the scanner must not treat high-bit bytes as control bytes).
+  std::string msg = "a\x01z \xC3\xA9tape";
+  errors::error err = errors::new_error(msg);
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, "a\\u0001z \xC3\xA9tape"));
+}
+
+void test_long_clean_run() {
+  // Longer than one vector block on both sides of the escape.
+  std::string msg(100, 'x');
+  msg += '"';
+  msg += std::string(100, 'y');
+  errors::error err = errors::new_error(msg);
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, std::string(100, 'x') + "\\\"" + std::string(100, 'y')));
+}
+
+void test_context_and_categories() {
+  constexpr auto cat_timeout = errors::category{1u << 0};
+  errors::error err = errors::new_error("slow");
+  err = errors::with_category(std::move(err), cat_timeout);
+  err = errors::with_context(std::move(err), "shard", std::int64_t{7});
+  err = errors::with_context(std::move(err), "user", std::string_view("u\"x"));
+  err = errors::with_context(std::move(err), "retry", true);
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, "\"categories\":1"));
+  CHECK(contains(json, "\"context\":{\"shard\":7,\"user\":\"u\\\"x\",\"retry\":true}"));
+}
+
+void test_sentinel_and_empty() {
+  static constexpr errors::static_error ERR_DOWN{"down"};
+  std::string json = errors::to_json(errors::error(ERR_DOWN));
+  CHECK(contains(json, "\"message\":\"down\""));
+  CHECK(contains(json, "\"chain\":[\"down\"]"));
+  CHECK(errors::to_json(errors::error()) == "{}");
+}
+
+void test_wrapped_sentinel_terminates_chain() {
+  static constexpr errors::static_error ERR_FULL{"disk full"};
+  errors::error err = errors::wrap(errors::error(ERR_FULL), "write object");
+  std::string json = errors::to_json(err);
+  CHECK(contains(json, "\"chain\":[\"write object\",\"disk full\"]"));
+}
+
+} // namespace
+
+int main() {
+  test_basic_shape();
+  test_escaping();
+  test_control_bytes_and_utf8();
+  test_long_clean_run();
+  test_context_and_categories();
+  test_sentinel_and_empty();
+  test_wrapped_sentinel_terminates_chain();
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include "errors/errors.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "errors/arena.hpp"
+#include "check.hpp"
+
+namespace {
+
+void test_short_message_inline() {
+  // Short messages fit the in-node buffer; nothing observable beyond the
+  // content, but the round trip must be exact.
+  errors::error err = errors::new_error("short");
+  CHECK(err.message() == "short");
+}
+
+void test_long_message_moved() {
+  std::string long_message(200, 'm');
+  const char *buffer = long_message.data();
+  errors::error err = errors::new_error(std::move(long_message));
+  CHECK(err.message().size() == 200);
+  // The rvalue's heap buffer was stolen, not copied.
+  CHECK(err.message().data() == buffer);
+}
+
+void test_static_message_zero_copy() {
+  static constexpr char msg[] = "ERR_TIMEOUT: deadline exceeded";
+  errors::error err = errors::new_error(errors::static_string(msg));
+  CHECK(err.message() == msg);
+  CHECK(err.message().data() == msg);
+}
+
+void test_static_wrap() {
+  errors::error err = errors::new_error("inner");
+  err = errors::wrap(std::move(err), errors::static_string("outer"));
+  CHECK(std::strcmp(err.what(), "outer: inner") == 0);
+}
+
+void test_arena_long_message_in_arena() {
+  errors::arena a;
+  std::string long_message(200, 'm');
+  errors::error err = errors::new_error(a, long_message);
+  CHECK(err.message() == long_message);
+  // Copied into the arena, not aliasing the caller's buffer.
+  CHECK(err.message().data() != long_message.data());
+}
+
+void test_boundary_sizes() {
+  for (std::size_t n : {0u, 1u, 39u, 40u, 41u, 64u}) {
+    std::string msg(n, 'b');
+    errors::error err = errors::new_error(msg);
+    CHECK(err.message() == msg);
+  }
+}
+
+} // namespace
+
+int main() {
+  test_short_message_inline();
+  test_long_message_moved();
+  test_static_message_zero_copy();
+  test_static_wrap();
+  test_arena_long_message_in_arena();
+  test_boundary_sizes();
+  return 0;
+}
@@ -0,0 +1,76 @@
+#include "errors/observe.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <utility>
+
+#include "errors/errors.hpp"
+#include "check.hpp"
+
+namespace {
+
+struct counting_observer : errors::observer {
+  std::atomic<std::uint64_t> created{0};
+  std::atomic<std::uint64_t> wrapped{0};
+  std::atomic<std::uint64_t> rendered{0};
+  std::atomic<std::uint64_t> callbacks{0};
+
+  void on_create(std::uint64_t count) override {
+    created += count;
+    ++callbacks;
+  }
+  void on_wrap(std::uint64_t count) override {
+    wrapped += count;
+    ++callbacks;
+  }
+  void on_render(std::uint64_t count) override {
+    rendered += count;
+    ++callbacks;
+  }
+};
+
+void test_counts_are_batched() {
+  counting_observer obs;
+  errors::set_observer(&obs);
+  for (int i = 0; i < 1000; ++i) {
+    errors::error err = errors::new_error("observed");
+    err = errors::wrap(std::move(err), "layer");
+    (void)std::strlen(err.what());
+  }
+  errors::flush_observed_events();
+  errors::set_observer(nullptr);
+
+  CHECK(obs.created == 1000);
+  CHECK(obs.wrapped == 1000);
+  CHECK(obs.rendered == 1000);
+  // Preaggregation: far fewer callbacks than events.
+  CHECK(obs.callbacks < 100);
+}
+
+void test_disabled_is_silent() {
+  counting_observer obs;
+  // Not installed: nothing is counted, nothing crashes.
+  errors::error err = errors::new_error("unobserved");
+  (void)err.what();
+  errors::flush_observed_events();
+  CHECK(obs.created == 0);
+}
+
+void test_flush_delivers_partial_batches() {
+  counting_observer obs;
+  errors::set_observer(&obs);
+  errors::error err = errors::new_error("one");
+  CHECK(obs.created == 0); // below the flush threshold
+  errors::flush_observed_events();
+  CHECK(obs.created == 1);
+  errors::set_observer(nullptr);
+}
+
+} // namespace
+
+int main() {
+  test_counts_are_batched();
+  test_disabled_is_silent();
+  test_flush_delivers_partial_batches();
+  return 0;
+}
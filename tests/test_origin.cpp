@@ -0,0 +1,63 @@
+#include "errors/errors.hpp"
+
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+void test_origin_is_the_call_site() {
+  errors::error err = errors::new_error("misplaced"); // anchor: created here
+  std::source_location loc = err.origin();
+  CHECK(std::string(loc.file_name()).find("test_origin.cpp") !=
+        std::string::npos);
+  CHECK(loc.line() == 11);
+  CHECK(std::string(loc.function_name()).find(
+            "test_origin_is_the_call_site") != std::string::npos);
+}
+
+void test_wrap_records_its_own_origin() {
+  errors::error inner = errors::new_error("inner");
+  std::uint_least32_t inner_line = inner.origin().line();
+  errors::error outer = errors::wrap(std::move(inner), "outer");
+  CHECK(outer.origin().line() != inner_line);
+  CHECK(outer.cause().origin().line() == inner_line);
+}
+
+void test_origin_only_skips_unwinding() {
+  errors::set_capture_policy(errors::capture_policy::origin_only);
+  errors::error err = errors::new_error("cheap");
+  errors::set_capture_policy(errors::capture_policy::lazy);
+
+  CHECK(err.trace().empty());
+  CHECK(err.origin().line() != 0);
+}
+
+void test_with_trace_overrides_origin_only() {
+  errors::set_capture_policy(errors::capture_policy::origin_only);
+  errors::error err = errors::with_trace("expensive on purpose");
+  errors::set_capture_policy(errors::capture_policy::lazy);
+
+  CHECK(!err.trace().empty());
+  CHECK(err.origin().line() != 0);
+}
+
+void test_empty_and_sentinel_have_no_origin() {
+  errors::error none;
+  CHECK(none.origin().line() == 0);
+  static constexpr errors::static_error ERR_X{"x"};
+  errors::error s{ERR_X};
+  CHECK(s.origin().line() == 0);
+}
+
+} // namespace
+
+int main() {
+  test_origin_is_the_call_site();
+  test_wrap_records_its_own_origin();
+  test_origin_only_skips_unwinding();
+  test_with_trace_overrides_origin_only();
+  test_empty_and_sentinel_have_no_origin();
+  return 0;
+}
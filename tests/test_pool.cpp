@@ -0,0 +1,76 @@
+#include "errors/pool.hpp"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "errors/errors.hpp"
+#include "check.hpp"
+
+namespace {
+
+void test_reserve_and_consume() {
+  errors::pool::reserve(8);
+  CHECK(errors::pool::available() == 8);
+  {
+    errors::error err = errors::new_error("pooled");
+    CHECK(errors::pool::available() == 7);
+    err = errors::wrap(std::move(err), "wrapped");
+    CHECK(errors::pool::available() == 6);
+  }
+  // Destruction pushes both nodes back.
+  CHECK(errors::pool::available() == 8);
+  errors::pool::drain();
+  CHECK(errors::pool::available() == 0);
+}
+
+void test_fallback_when_exhausted() {
+  errors::pool::reserve(1);
+  errors::error a = errors::new_error("from pool");
+  errors::error b = errors::new_error("from heap");
+  CHECK(errors::pool::available() == 0);
+  CHECK(a.message() == "from pool");
+  CHECK(b.message() == "from heap");
+  a = errors::error();
+  CHECK(errors::pool::available() == 1);
+  // Heap-backed errors do not join the pool on destruction.
+  b = errors::error();
+  CHECK(errors::pool::available() == 1);
+  errors::pool::drain();
+}
+
+void test_cross_thread_destruction() {
+  errors::error err;
+  std::thread producer([&err] {
+    errors::pool::reserve(2);
+    err = errors::new_error("made elsewhere");
+    errors::pool::drain();
+  });
+  producer.join();
+  CHECK(err.message() == "made elsewhere");
+  // Destroying on this thread pushes the node onto this thread's list.
+  std::size_t before = errors::pool::available();
+  err = errors::error();
+  CHECK(errors::pool::available() == before + 1);
+  errors::pool::drain();
+}
+
+void test_churn() {
+  errors::pool::reserve(4);
+  for (int i = 0; i < 10000; ++i) {
+    errors::error err = errors::new_error("transient");
+    err = errors::wrap(std::move(err), "layer");
+  }
+  CHECK(errors::pool::available() == 4);
+  errors::pool::drain();
+}
+
+} // namespace
+
+int main() {
+  test_reserve_and_consume();
+  test_fallback_when_exhausted();
+  test_cross_thread_destruction();
+  test_churn();
+  return 0;
+}
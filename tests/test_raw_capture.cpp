@@ -0,0 +1,78 @@
+#include "errors/errors.hpp"
+
+#include <csignal>
+#include <cstddef>
+#include <string>
+
+#include "check.hpp"
+
+// Snapshot taken inside the signal handler, inspected afterwards on the
+// normal path — the pattern a crash reporter uses.
+namespace {
+void *g_handler_frames[32];
+volatile std::size_t g_handler_count = 0;
+} // namespace
+
+extern "C" void errors_test_on_signal(int) {
+  g_handler_count =
+      errors::capture_raw(std::span<void *>(g_handler_frames, 32));
+}
+
+// External linkage and noinline so the frame resolves via the dynamic
+// symbol table.
+[[gnu::noinline]] void errors_test_raise_from_here() {
+  std::raise(SIGUSR1);
+  // Keep work after raise() so optimized builds cannot turn the call
+  // into a tail jump — that would pop this frame before the handler
+  // runs and the capture below would never see it.
+  asm volatile("" ::: "memory");
+}
+
+namespace {
+
+void test_capture_in_signal_handler() {
+  std::signal(SIGUSR1, errors_test_on_signal);
+  errors_test_raise_from_here();
+  std::signal(SIGUSR1, SIG_DFL);
+  CHECK(g_handler_count > 0);
+
+  errors::error err = errors::from_raw_capture(
+      std::span<void *const>(g_handler_frames, g_handler_count),
+      "snapshot from signal handler");
+  CHECK(err.message() == "snapshot from signal handler");
+  CHECK(err.trace().size() == g_handler_count);
+  bool found = false;
+  for (const errors::frame &f : err.trace()) {
+    if (f.function.find("errors_test_raise_from_here") != std::string::npos) {
+      found = true;
+    }
+  }
+  CHECK(found);
+}
+
+void test_capture_raw_on_normal_path() {
+  void *frames[8];
+  std::size_t count = errors::capture_raw(std::span<void *>(frames, 8));
+  CHECK(count > 0);
+  CHECK(count <= 8);
+}
+
+void test_from_empty_capture() {
+  errors::error err = errors::from_raw_capture({}, "no frames");
+  CHECK(err.trace().empty());
+  CHECK(err.message() == "no frames");
+}
+
+void test_zero_sized_buffer() {
+  CHECK(errors::capture_raw({}) == 0);
+}
+
+} // namespace
+
+int main() {
+  test_capture_in_signal_handler();
+  test_capture_raw_on_normal_path();
+  test_from_empty_capture();
+  test_zero_sized_buffer();
+  return 0;
+}
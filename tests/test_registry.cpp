@@ -0,0 +1,104 @@
+#include "errors/registry.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+constexpr auto cat_retryable = errors::category{1u << 1};
+
+void test_register_and_find() {
+  errors::register_domain(100, "storage", cat_retryable);
+  const errors::domain_info *d = errors::find_domain(100);
+  CHECK(d != nullptr);
+  CHECK(d->code == 100);
+  CHECK(d->name == "storage");
+  CHECK(any(d->categories & cat_retryable));
+}
+
+void test_missing_code() {
+  CHECK(errors::find_domain(999999) == nullptr);
+  CHECK(errors::find_domain(0) == nullptr);
+}
+
+void test_re_registration_updates() {
+  errors::register_domain(200, "net");
+  errors::register_domain(200, "network", cat_retryable);
+  const errors::domain_info *d = errors::find_domain(200);
+  CHECK(d != nullptr);
+  CHECK(d->name == "network");
+  CHECK(any(d->categories & cat_retryable));
+}
+
+void test_startup_scale() {
+  // The stated workload: ~500 codes registered at startup.  The bulk
+  // call builds one snapshot for the whole batch.
+  std::vector<std::string> names;
+  std::vector<errors::domain_info> batch;
+  for (std::uint64_t code = 1000; code < 1500; ++code) {
+    names.push_back("domain-" + std::to_string(code));
+  }
+  for (std::uint64_t code = 1000; code < 1500; ++code) {
+    batch.push_back({code, names[code - 1000], errors::category::none});
+  }
+  errors::register_domains(batch);
+  for (std::uint64_t code = 1000; code < 1500; ++code) {
+    const errors::domain_info *d = errors::find_domain(code);
+    CHECK(d != nullptr);
+    CHECK(d->name == "domain-" + std::to_string(code));
+  }
+}
+
+void test_pointers_survive_later_registrations() {
+  errors::register_domain(300, "first");
+  const errors::domain_info *d = errors::find_domain(300);
+  for (std::uint64_t code = 301; code < 400; ++code) {
+    errors::register_domain(code, "later");
+  }
+  // Snapshots are immutable once published: the old pointer still reads
+  // the metadata it resolved to.
+  CHECK(d->code == 300);
+  CHECK(d->name == "first");
+}
+
+void test_concurrent_lookups_during_registration() {
+  errors::register_domain(500, "stable");
+  std::atomic<bool> stop{false};
+  std::atomic<std::uint64_t> found{0};
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 4; ++t) {
+    readers.emplace_back([&] {
+      while (!stop.load(std::memory_order_relaxed)) {
+        const errors::domain_info *d = errors::find_domain(500);
+        CHECK(d != nullptr);
+        CHECK(d->name == "stable");
+        found.fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for (std::uint64_t code = 600; code < 1000; ++code) {
+    errors::register_domain(code, "churn");
+  }
+  stop.store(true);
+  for (std::thread &t : readers) {
+    t.join();
+  }
+  CHECK(found.load() > 0);
+}
+
+} // namespace
+
+int main() {
+  test_register_and_find();
+  test_missing_code();
+  test_re_registration_updates();
+  test_startup_scale();
+  test_pointers_survive_later_registrations();
+  test_concurrent_lookups_during_registration();
+  return 0;
+}
@@ -0,0 +1,71 @@
+#include "errors/errors.hpp"
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+std::size_t traced_of(std::size_t n) {
+  std::size_t traced = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    errors::error err = errors::new_error(std::string("storm"));
+    if (!err.trace().empty()) {
+      ++traced;
+    }
+  }
+  return traced;
+}
+
+void test_one_in_n_per_site() {
+  errors::set_capture_policy(errors::capture_policy::sampled);
+  errors::set_trace_sample_rate(10);
+  // 100 errors from one call site: the first plus every tenth capture.
+  std::size_t traced = traced_of(100);
+  errors::set_capture_policy(errors::capture_policy::lazy);
+  CHECK(traced == 10);
+}
+
+void test_sites_are_independent() {
+  errors::set_capture_policy(errors::capture_policy::sampled);
+  errors::set_trace_sample_rate(1000);
+  // A second call site gets its own counter: its first error captures
+  // even though the site above has long since started skipping.
+  errors::error err = errors::new_error(std::string("other site"));
+  errors::set_capture_policy(errors::capture_policy::lazy);
+  CHECK(!err.trace().empty());
+}
+
+void test_rate_one_captures_always() {
+  errors::set_capture_policy(errors::capture_policy::sampled);
+  errors::set_trace_sample_rate(1);
+  std::size_t traced = traced_of(20);
+  errors::set_capture_policy(errors::capture_policy::lazy);
+  errors::set_trace_sample_rate(16);
+  CHECK(traced == 20);
+}
+
+void test_sampled_out_errors_still_render() {
+  errors::set_capture_policy(errors::capture_policy::sampled);
+  errors::set_trace_sample_rate(2);
+  errors::error first = errors::new_error(std::string("kept"));
+  errors::error second = errors::new_error(std::string("dropped"));
+  errors::set_capture_policy(errors::capture_policy::lazy);
+  errors::set_trace_sample_rate(16);
+
+  errors::error wrapped = errors::wrap(std::move(second), "context");
+  CHECK(std::string(wrapped.what()) == "context: dropped");
+  CHECK(!first.trace().empty());
+}
+
+} // namespace
+
+int main() {
+  test_one_in_n_per_site();
+  test_sites_are_independent();
+  test_rate_one_captures_always();
+  test_sampled_out_errors_still_render();
+  return 0;
+}
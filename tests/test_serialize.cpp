@@ -0,0 +1,90 @@
+#include "errors/serialize.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+inline constexpr errors::static_error kErrTimeout{"timeout"};
+
+void test_round_trip_chain() {
+  errors::error err = errors::new_error("connection refused");
+  err = errors::wrap(std::move(err), "dial tcp 10.0.0.1:443");
+  err = errors::wrap(std::move(err), "fetch shard 7");
+
+  std::string wire = errors::serialize(err);
+  errors::error decoded;
+  errors::error parse_err = errors::deserialize(wire, decoded);
+  CHECK(!parse_err);
+  CHECK(std::strcmp(decoded.what(),
+                    "fetch shard 7: dial tcp 10.0.0.1:443: "
+                    "connection refused") == 0);
+  CHECK(decoded.cause().message() == "dial tcp 10.0.0.1:443");
+}
+
+void test_zero_copy_views() {
+  errors::error err = errors::new_error(std::string(100, 'z'));
+  std::string wire = errors::serialize(err);
+  errors::error decoded;
+  CHECK(!errors::deserialize(wire, decoded));
+  const char *msg_data = decoded.message().data();
+  CHECK(msg_data >= wire.data() && msg_data < wire.data() + wire.size());
+}
+
+void test_sentinel_survives_as_message() {
+  errors::error err = errors::wrap(errors::error(kErrTimeout), "rpc call");
+  std::string wire = errors::serialize(err);
+  errors::error decoded;
+  CHECK(!errors::deserialize(wire, decoded));
+  CHECK(std::strcmp(decoded.what(), "rpc call: timeout") == 0);
+}
+
+void test_empty_error_round_trip() {
+  std::string wire = errors::serialize(errors::error());
+  errors::error decoded = errors::new_error("sacrificial");
+  CHECK(!errors::deserialize(wire, decoded));
+  CHECK(!decoded);
+}
+
+void test_malformed_input() {
+  errors::error decoded;
+  errors::error parse_err = errors::deserialize("not a wire chain", decoded);
+  CHECK(parse_err);
+  CHECK(errors::is(parse_err, errors::bad_wire_format));
+  CHECK(!decoded);
+
+  // Truncate a valid encoding at every prefix length; none may succeed
+  // with garbage or crash.
+  std::string wire = errors::serialize(errors::new_error("hello world"));
+  for (std::size_t n = 0; n < wire.size(); ++n) {
+    errors::error out;
+    errors::error e = errors::deserialize(wire.substr(0, n), out);
+    CHECK(e);
+    CHECK(errors::is(e, errors::bad_wire_format));
+  }
+}
+
+void test_trace_addresses_survive() {
+  errors::error err = errors::new_error("traced");
+  std::size_t frames = err.trace().size();
+  std::string wire = errors::serialize(err);
+  errors::error decoded;
+  CHECK(!errors::deserialize(wire, decoded));
+  // Same-process round trip: addresses resolve identically.
+  CHECK(decoded.trace().size() == frames);
+}
+
+} // namespace
+
+int main() {
+  test_round_trip_chain();
+  test_zero_copy_views();
+  test_sentinel_survives_as_message();
+  test_empty_error_round_trip();
+  test_malformed_input();
+  test_trace_addresses_survive();
+  return 0;
+}
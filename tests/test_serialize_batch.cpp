@@ -0,0 +1,114 @@
+#include "errors/serialize.hpp"
+
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+namespace {
+
+inline constexpr errors::static_error kErrBusy{"resource busy"};
+
+// One creation site so every error in a batch shares its trace suffix.
+[[gnu::noinline]] errors::error make_shard_error(int shard) {
+  return errors::wrap(errors::new_error("connection refused"),
+                      "shard " + std::to_string(shard));
+}
+
+void test_round_trip_batch() {
+  std::vector<errors::error> batch;
+  for (int i = 0; i < 10; ++i) {
+    batch.push_back(make_shard_error(i));
+  }
+  std::string wire = errors::serialize_batch(batch);
+  std::vector<errors::error> decoded;
+  CHECK(!errors::deserialize_batch(wire, decoded));
+  CHECK(decoded.size() == 10);
+  CHECK(std::strcmp(decoded[3].what(), "shard 3: connection refused") == 0);
+  CHECK(decoded[7].cause().message() == "connection refused");
+}
+
+void test_shared_data_is_deduped() {
+  // Same message and same capture site throughout: the batch encoding
+  // must grow far slower than per-error serialization.
+  std::vector<errors::error> batch;
+  for (int i = 0; i < 1000; ++i) {
+    batch.push_back(make_shard_error(42));
+  }
+  std::string wire = errors::serialize_batch(batch);
+  std::size_t individually = 0;
+  for (const errors::error &err : batch) {
+    individually += errors::serialize(err).size();
+  }
+  CHECK(wire.size() < individually / 10);
+}
+
+void test_traces_survive() {
+  std::vector<errors::error> batch;
+  batch.push_back(errors::new_error("traced"));
+  std::size_t frames = batch[0].trace().size();
+  CHECK(frames > 0);
+  std::string wire = errors::serialize_batch(batch);
+  std::vector<errors::error> decoded;
+  CHECK(!errors::deserialize_batch(wire, decoded));
+  CHECK(decoded[0].trace().size() == frames);
+  CHECK(decoded[0].trace()[0].ip == batch[0].trace()[0].ip);
+}
+
+void test_mixed_batch() {
+  std::vector<errors::error> batch;
+  batch.push_back(errors::error()); // empty slots round-trip as empty
+  batch.push_back(errors::error(kErrBusy));
+  batch.push_back(errors::wrap(errors::error(kErrBusy), "acquire lock"));
+  std::string wire = errors::serialize_batch(batch);
+  std::vector<errors::error> decoded;
+  CHECK(!errors::deserialize_batch(wire, decoded));
+  CHECK(decoded.size() == 3);
+  CHECK(!decoded[0]);
+  CHECK(decoded[1].message() == "resource busy");
+  CHECK(std::strcmp(decoded[2].what(), "acquire lock: resource busy") == 0);
+}
+
+void test_empty_batch() {
+  std::string wire = errors::serialize_batch({});
+  std::vector<errors::error> decoded;
+  decoded.push_back(errors::new_error("sacrificial"));
+  CHECK(!errors::deserialize_batch(wire, decoded));
+  CHECK(decoded.empty());
+}
+
+void test_malformed_input() {
+  std::vector<errors::error> decoded;
+  errors::error parse_err =
+      errors::deserialize_batch("not a batch stream", decoded);
+  CHECK(parse_err);
+  CHECK(errors::is(parse_err, errors::bad_wire_format));
+
+  // Truncate a valid stream at every prefix length; none may succeed
+  // with garbage or crash.
+  std::vector<errors::error> batch;
+  batch.push_back(make_shard_error(1));
+  batch.push_back(make_shard_error(2));
+  std::string wire = errors::serialize_batch(batch);
+  for (std::size_t n = 0; n < wire.size(); ++n) {
+    std::vector<errors::error> out;
+    errors::error e = errors::deserialize_batch(wire.substr(0, n), out);
+    CHECK(e);
+    CHECK(errors::is(e, errors::bad_wire_format));
+    CHECK(out.empty());
+  }
+}
+
+} // namespace
+
+int main() {
+  test_round_trip_batch();
+  test_shared_data_is_deduped();
+  test_traces_survive();
+  test_mixed_batch();
+  test_empty_batch();
+  test_malformed_input();
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include "errors/errors.hpp"
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "errors/context.hpp"
+#include "check.hpp"
+
+namespace {
+
+void test_share_is_same_chain() {
+  errors::error err = errors::wrap(errors::new_error("inner"), "outer");
+  errors::error copy = err.share();
+  CHECK(errors::is(copy, err));
+  CHECK(std::string(copy.what()) == "outer: inner");
+  CHECK(std::string(err.what()) == "outer: inner");
+}
+
+void test_broadcast_to_waiters() {
+  // The fan-out pattern: one failure handed to many queued waiters.
+  errors::error upstream = errors::wrap(errors::new_error("disk"), "fetch");
+  std::vector<errors::error> waiters;
+  for (int i = 0; i < 200; ++i) {
+    waiters.push_back(upstream.share());
+  }
+  for (errors::error &w : waiters) {
+    CHECK(errors::is(w, upstream));
+  }
+  waiters.clear();
+  // The original still owns a live chain after every copy is gone.
+  CHECK(std::string(upstream.what()) == "fetch: disk");
+}
+
+void test_cause_outlives_owner() {
+  errors::error inner_view;
+  {
+    errors::error err = errors::wrap(errors::new_error("root"), "layer");
+    inner_view = err.cause();
+  }
+  // cause() hands out an owning reference, so the tail survives the
+  // outer error's destruction.
+  CHECK(inner_view.message() == "root");
+}
+
+void test_wrap_shares_tail() {
+  errors::error base = errors::new_error("base");
+  errors::error shared = base.share();
+  errors::error wrapped = errors::wrap(std::move(shared), "for waiter 1");
+  // Wrapping a shared handle builds a private head over the shared tail.
+  CHECK(errors::is(wrapped, base));
+  CHECK(std::string(wrapped.what()) == "for waiter 1: base");
+  CHECK(base.message() == "base");
+}
+
+void test_with_category_copies_on_write() {
+  constexpr auto cat_retryable = errors::category{1u << 1};
+  errors::error a = errors::new_error("flaky");
+  errors::error b = a.share();
+  b = errors::with_category(std::move(b), cat_retryable);
+  CHECK(errors::has_category(b, cat_retryable));
+  // The other holder never sees the bit.
+  CHECK(!errors::has_category(a, cat_retryable));
+  CHECK(errors::is(b, a));
+}
+
+void test_with_context_copies_on_write() {
+  errors::error a = errors::new_error("flaky");
+  errors::error b = a.share();
+  b = errors::with_context(std::move(b), "waiter", std::int64_t{7});
+  CHECK(errors::context(b).size() == 1);
+  CHECK(errors::context(a).empty());
+}
+
+void test_share_sentinel_and_empty() {
+  static constexpr errors::static_error ERR_GONE{"gone"};
+  errors::error s{ERR_GONE};
+  CHECK(errors::is(s.share(), ERR_GONE));
+  errors::error none;
+  CHECK(!none.share());
+}
+
+void test_concurrent_share_and_drop() {
+  errors::error err = errors::wrap(errors::new_error("inner"), "outer");
+  constexpr int threads = 8;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([copy = err.share()] {
+      for (int i = 0; i < 1000; ++i) {
+        errors::error local = copy.share();
+        CHECK(local.message() == "outer");
+      }
+    });
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  CHECK(std::string(err.what()) == "outer: inner");
+}
+
+} // namespace
+
+int main() {
+  test_share_is_same_chain();
+  test_broadcast_to_waiters();
+  test_cause_outlives_owner();
+  test_wrap_shares_tail();
+  test_with_category_copies_on_write();
+  test_with_context_copies_on_write();
+  test_share_sentinel_and_empty();
+  test_concurrent_share_and_drop();
+  return 0;
+}
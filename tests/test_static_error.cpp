@@ -0,0 +1,72 @@
+#include "errors/errors.hpp"
+
+#include <cstring>
+#include <utility>
+
+#include "check.hpp"
+
+namespace {
+
+// Sentinels as they would appear in application headers: constexpr,
+// .rodata, no runtime initialization.
+inline constexpr errors::static_error kErrTimeout{"timeout"};
+inline constexpr errors::static_error kErrNotFound{"not found"};
+
+errors::error do_lookup(bool found) {
+  if (!found) {
+    return kErrNotFound;
+  }
+  return errors::error();
+}
+
+void test_sentinel_identity() {
+  errors::error err = do_lookup(false);
+  CHECK(err);
+  CHECK(errors::is(err, kErrNotFound));
+  CHECK(!errors::is(err, kErrTimeout));
+  CHECK(err.message() == "not found");
+  CHECK(std::strcmp(err.what(), "not found") == 0);
+  CHECK(err.trace().empty());
+}
+
+void test_wrapped_sentinel() {
+  errors::error err = do_lookup(false);
+  err = errors::wrap(std::move(err), "loading user 42");
+  err = errors::wrap(std::move(err), "handling request");
+  CHECK(errors::is(err, kErrNotFound));
+  CHECK(!errors::is(err, kErrTimeout));
+  CHECK(std::strcmp(err.what(),
+                    "handling request: loading user 42: not found") == 0);
+}
+
+void test_cause_reaches_sentinel() {
+  errors::error err = errors::wrap(errors::error(kErrTimeout), "rpc");
+  errors::error inner = err.cause();
+  CHECK(inner.message() == "timeout");
+  CHECK(errors::is(inner, kErrTimeout));
+  CHECK(!inner.cause());
+}
+
+void test_sentinel_copy_is_free_and_comparable() {
+  errors::error a = kErrTimeout;
+  errors::error b = kErrTimeout;
+  // Two independently obtained handles to the same sentinel compare
+  // equal under is(), unlike two new_error() chains.
+  CHECK(errors::is(a, b));
+}
+
+void test_empty_vs_sentinel() {
+  errors::error err;
+  CHECK(!errors::is(err, kErrTimeout));
+}
+
+} // namespace
+
+int main() {
+  test_sentinel_identity();
+  test_wrapped_sentinel();
+  test_cause_reaches_sentinel();
+  test_sentinel_copy_is_free_and_comparable();
+  test_empty_vs_sentinel();
+  return 0;
+}
@@ -0,0 +1,61 @@
+#include "errors/symbolize.hpp"
+
+#include <string>
+
+#include "errors/errors.hpp"
+#include "check.hpp"
+
+// External linkage and noinline so the frame resolves via the dynamic
+// symbol table (see test_trace.cpp).
+[[gnu::noinline]] errors::error errors_test_hot_site() {
+  return errors::new_error("hot site failure");
+}
+
+namespace {
+
+void test_repeat_resolution_hits_cache() {
+  errors::error first = errors_test_hot_site();
+  (void)first.trace(); // cold: populates the cache
+
+  errors::symbolizer_stats before = errors::get_symbolizer_stats();
+  errors::error second = errors_test_hot_site();
+  std::span<const errors::frame> frames = second.trace();
+  errors::symbolizer_stats after = errors::get_symbolizer_stats();
+
+  CHECK(!frames.empty());
+  CHECK(after.lookups > before.lookups);
+  // The second capture shares the call-site addresses of the first, so
+  // nearly all of its frames must be cache hits.
+  CHECK(after.hits - before.hits >= frames.size() - 1);
+}
+
+void test_cached_resolution_matches_uncached() {
+  errors::error first = errors_test_hot_site();
+  errors::error second = errors_test_hot_site();
+  bool found = false;
+  for (const errors::frame &f : second.trace()) {
+    if (f.function.find("errors_test_hot_site") != std::string::npos) {
+      found = true;
+    }
+  }
+  CHECK(found);
+  (void)first;
+}
+
+void test_numa_replicas_reported() {
+  // One replica per NUMA node; at least one on any host, and resolution
+  // keeps working regardless of which replica serves this thread.
+  errors::symbolizer_stats stats = errors::get_symbolizer_stats();
+  CHECK(stats.numa_replicas >= 1);
+  errors::error err = errors_test_hot_site();
+  CHECK(!err.trace().empty());
+}
+
+} // namespace
+
+int main() {
+  test_repeat_resolution_hits_cache();
+  test_cached_resolution_matches_uncached();
+  test_numa_replicas_reported();
+  return 0;
+}
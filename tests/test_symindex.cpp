@@ -0,0 +1,69 @@
+#include "errors/symbolize.hpp"
+
+#include <cstdio>
+#include <string>
+
+#include "symindex.hpp"
+#include "check.hpp"
+
+// External linkage and noinline so the symbol appears in the index under
+// a predictable name.
+[[gnu::noinline]] errors::error errors_test_indexed_site() {
+  return errors::new_error("indexed failure");
+}
+
+namespace {
+
+const char *index_path() { return "test_symindex.symidx"; }
+
+void test_write_index_for_self() {
+  errors::error err =
+      errors::detail::write_symbol_index("/proc/self/exe", index_path());
+  CHECK(!err);
+}
+
+void test_load_and_resolve() {
+  CHECK(!errors::load_symbol_index(index_path()));
+
+  errors::error err = errors_test_indexed_site();
+  bool found = false;
+  for (const errors::frame &f : err.trace()) {
+    if (f.function.find("errors_test_indexed_site") != std::string::npos) {
+      found = true;
+    }
+  }
+  CHECK(found);
+}
+
+void test_direct_lookup() {
+  errors::frame f;
+  CHECK(errors::detail::symindex_lookup(
+      reinterpret_cast<const void *>(&errors_test_indexed_site), f));
+  CHECK(f.function.find("errors_test_indexed_site") != std::string::npos);
+  CHECK(!f.object.empty());
+}
+
+void test_unmapped_address_misses() {
+  errors::frame f;
+  CHECK(!errors::detail::symindex_lookup(nullptr, f));
+}
+
+void test_bad_files_are_rejected() {
+  CHECK(errors::load_symbol_index("/nonexistent/index"));
+  // A valid ELF binary is not a valid index.
+  errors::error err = errors::load_symbol_index("/proc/self/exe");
+  CHECK(err);
+  CHECK(std::string(err.what()).find("bad index") != std::string::npos);
+}
+
+} // namespace
+
+int main() {
+  test_write_index_for_self();
+  test_load_and_resolve();
+  test_direct_lookup();
+  test_unmapped_address_misses();
+  test_bad_files_are_rejected();
+  std::remove(index_path());
+  return 0;
+}
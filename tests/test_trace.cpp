@@ -0,0 +1,73 @@
+#include "errors/errors.hpp"
+
+#include <string>
+
+#include "check.hpp"
+
+// External linkage and noinline so the frame reliably shows up in the
+// capture and resolves via the dynamic symbol table.
+[[gnu::noinline]] errors::error errors_test_make_failure() {
+  return errors::new_error("deep failure");
+}
+
+namespace {
+
+void test_trace_captured() {
+  errors::error err = errors_test_make_failure();
+  std::span<const errors::frame> frames = err.trace();
+  CHECK(!frames.empty());
+  // At least one frame should resolve back into this test binary.
+  bool found = false;
+  for (const errors::frame &f : frames) {
+    if (f.function.find("errors_test_make_failure") != std::string::npos) {
+      found = true;
+    }
+  }
+  CHECK(found);
+}
+
+void test_trace_stable_across_calls() {
+  errors::error err = errors_test_make_failure();
+  std::span<const errors::frame> first = err.trace();
+  std::span<const errors::frame> second = err.trace();
+  CHECK(first.data() == second.data());
+  CHECK(first.size() == second.size());
+}
+
+void test_eager_policy() {
+  CHECK(errors::get_capture_policy() == errors::capture_policy::lazy);
+  errors::set_capture_policy(errors::capture_policy::eager);
+  errors::error err = errors_test_make_failure();
+  CHECK(!err.trace().empty());
+  errors::set_capture_policy(errors::capture_policy::lazy);
+}
+
+void test_empty_error_has_no_trace() {
+  errors::error err;
+  CHECK(err.trace().empty());
+}
+
+void test_max_trace_depth() {
+  CHECK(errors::get_max_trace_depth() == 32);
+  errors::set_max_trace_depth(4);
+  errors::error err = errors_test_make_failure();
+  CHECK(err.trace().size() <= 4);
+  // Values above the compiled-in maximum clamp.
+  errors::set_max_trace_depth(1000);
+  CHECK(errors::get_max_trace_depth() == 32);
+  // Depth zero disables capture entirely.
+  errors::set_max_trace_depth(0);
+  CHECK(errors_test_make_failure().trace().empty());
+  errors::set_max_trace_depth(32);
+}
+
+} // namespace
+
+int main() {
+  test_trace_captured();
+  test_trace_stable_across_calls();
+  test_eager_policy();
+  test_empty_error_has_no_trace();
+  test_max_trace_depth();
+  return 0;
+}
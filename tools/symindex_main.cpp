@@ -0,0 +1,29 @@
+// errors-symindex: precomputes a symbol index for a binary at build time.
+//
+// Usage: errors-symindex <binary> <output-index>
+//
+// The index holds every function symbol of the binary, sorted by address
+// with names pre-demangled; load it at runtime with
+// errors::load_symbol_index() to make first symbolization a binary
+// search over a memory-mapped file.  Typical integration:
+//
+//   add_custom_command(TARGET server POST_BUILD
+//     COMMAND errors-symindex $<TARGET_FILE:server>
+//                             $<TARGET_FILE:server>.symidx)
+
+#include <cstdio>
+
+#include "symindex.hpp"
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    std::fprintf(stderr, "usage: %s <binary> <output-index>\n", argv[0]);
+    return 2;
+  }
+  errors::error err = errors::detail::write_symbol_index(argv[1], argv[2]);
+  if (err) {
+    std::fprintf(stderr, "%s\n", err.what());
+    return 1;
+  }
+  return 0;
+}